@@ -4,19 +4,34 @@
 
 class CollisionComponent : public ECS::Component
 {
+private:
+    ECS::TagID tagID; // Tag interné: seule source de vérité (comparaisons entières), voir setTag
+
+    static ECS::TagID defaultTag()
+    {
+        static const ECS::TagID id = ECS::getTagID("default");
+        return id;
+    }
+
 public:
     Vector2D offset;
     float width, height;
-    std::string tag;
 
     CollisionComponent()
-        : offset(0, 0), width(0), height(0), tag("default") {}
+        : tagID(defaultTag()), offset(0, 0), width(0), height(0) {}
 
     CollisionComponent(float w, float h)
-        : offset(0, 0), width(w), height(h), tag("default") {}
+        : tagID(defaultTag()), offset(0, 0), width(w), height(h) {}
 
     CollisionComponent(float offsetX, float offsetY, float w, float h, const std::string &collisionTag = "default")
-        : offset(offsetX, offsetY), width(w), height(h), tag(collisionTag) {}
+        : tagID(ECS::getTagID(collisionTag)), offset(offsetX, offsetY), width(w), height(h) {}
+
+    void setTag(const std::string &collisionTag) { tagID = ECS::getTagID(collisionTag); }
+    void setTag(ECS::TagID id) { tagID = id; }
+
+    const std::string &getTag() const { return ECS::getTagName(tagID); }
+    ECS::TagID getTagID() const { return tagID; }
+    bool hasTag(ECS::TagID id) const { return tagID == id; }
 
     SDL_FRect getRect(const Vector2D& entityPosition) const
     {
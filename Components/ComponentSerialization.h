@@ -0,0 +1,134 @@
+#pragma once
+#include "../ECS.h"
+#include "TransformComponent.h"
+#include "CameraComponent.h"
+#include "CollisionComponent.h"
+#include "SpriteComponent.h"
+#include "AnimationComponent.h"
+#include "HierarchyComponent.h"
+#include <functional>
+#include <string>
+
+/*
+ * ============================================================================
+ * registerEngineComponents - Composants du moteur pour les snapshots
+ * ============================================================================
+ * Transform, Camera et Hierarchy n'ont que des champs plats: copie brute (Raw)
+ * des champs listés.
+ * Les handles étant conservés par les snapshots, le parent d'Hierarchy reste valide.
+ * Collision et Animation contiennent des std::string/std::map, et Sprite une
+ * texture SDL: ils ont leur propre serializer.
+ *
+ * Une texture ne peut pas être sauvegardée: seul son nom l'est, via
+ * textureName (texture -> nom), et findTexture (nom -> texture) la retrouve
+ * au chargement. Sans ces callbacks, les sprites chargés n'ont pas de texture.
+ *
+ * TileMapComponent n'est pas enregistré: la map se recharge depuis son fichier Tiled.
+ *
+ * Usage (une fois au démarrage, avant le premier saveSnapshot/loadSnapshot):
+ *   registerEngineComponents(
+ *       [&](SDL_Texture *texture) { return assets.getTextureName(texture); },
+ *       [&](const std::string &name) { return assets.getTexture(name); });
+ * ============================================================================
+ */
+
+inline void registerEngineComponents(std::function<std::string(SDL_Texture *)> textureName = nullptr,
+                                     std::function<SDL_Texture *(const std::string &)> findTexture = nullptr)
+{
+    ECS::registerComponent<TransformComponent>(
+        "Transform",
+        &TransformComponent::position, &TransformComponent::velocity,
+        &TransformComponent::scale, &TransformComponent::rotation,
+        &TransformComponent::previousPosition, &TransformComponent::previousRotation,
+        &TransformComponent::steppedPosition, &TransformComponent::steppedRotation);
+    ECS::registerComponent<CameraComponent>(
+        "Camera",
+        &CameraComponent::position, &CameraComponent::viewportWidth, &CameraComponent::viewportHeight,
+        &CameraComponent::zoom,
+        &CameraComponent::minX, &CameraComponent::maxX, &CameraComponent::minY, &CameraComponent::maxY);
+    ECS::registerComponent<HierarchyComponent>(
+        "Hierarchy",
+        &HierarchyComponent::parent, &HierarchyComponent::localPosition,
+        &HierarchyComponent::localRotation, &HierarchyComponent::localScale);
+
+    ECS::registerComponent<CollisionComponent>(
+        "Collision",
+        [](const CollisionComponent &collision, BinaryWriter &out)
+        {
+            out.write(collision.offset.x);
+            out.write(collision.offset.y);
+            out.write(collision.width);
+            out.write(collision.height);
+            out.writeString(collision.getTag());
+        },
+        [](CollisionComponent &collision, BinaryReader &in)
+        {
+            collision.offset.x = in.read<float>();
+            collision.offset.y = in.read<float>();
+            collision.width = in.read<float>();
+            collision.height = in.read<float>();
+            collision.setTag(in.readString());
+        });
+
+    ECS::registerComponent<SpriteComponent>(
+        "Sprite",
+        [textureName](const SpriteComponent &sprite, BinaryWriter &out)
+        {
+            out.writeString(sprite.texture && textureName ? textureName(sprite.texture) : std::string());
+            out.write(sprite.srcRect);
+            out.write(sprite.dstRect);
+            out.write(sprite.width);
+            out.write(sprite.height);
+            out.write(sprite.flipHorizontal);
+            out.write(sprite.flipVertical);
+            out.write(sprite.renderLayer);
+        },
+        [findTexture](SpriteComponent &sprite, BinaryReader &in)
+        {
+            std::string name = in.readString();
+            sprite.texture = !name.empty() && findTexture ? findTexture(name) : nullptr;
+            sprite.srcRect = in.read<SDL_Rect>();
+            sprite.dstRect = in.read<SDL_Rect>();
+            sprite.width = in.read<int>();
+            sprite.height = in.read<int>();
+            sprite.flipHorizontal = in.read<bool>();
+            sprite.flipVertical = in.read<bool>();
+            sprite.renderLayer = in.read<int>();
+        });
+
+    // lastFrameTime n'est pas sauvegardé: init() le remet à SDL_GetTicks() au chargement
+    ECS::registerComponent<AnimationComponent>(
+        "Animation",
+        [](const AnimationComponent &animation, BinaryWriter &out)
+        {
+            out.writeString(animation.currentAnimState);
+            out.write(animation.currentFrame);
+            out.write(animation.isPlaying);
+            out.write(static_cast<std::uint32_t>(animation.animations.size()));
+            for (const auto &entry : animation.animations)
+            {
+                // Champ par champ: pas d'octets de padding dans le fichier
+                out.writeString(entry.first);
+                out.write(entry.second.index);
+                out.write(entry.second.frames);
+                out.write(entry.second.speed);
+                out.write(entry.second.loop);
+            }
+        },
+        [](AnimationComponent &animation, BinaryReader &in)
+        {
+            animation.currentAnimState = in.readString();
+            animation.currentFrame = in.read<int>();
+            animation.isPlaying = in.read<bool>();
+            std::uint32_t count = in.read<std::uint32_t>();
+            for (std::uint32_t i = 0; i < count && !in.failed(); ++i)
+            {
+                std::string name = in.readString();
+                Animation &entry = animation.animations[name];
+                entry.index = in.read<int>();
+                entry.frames = in.read<int>();
+                entry.speed = in.read<int>();
+                entry.loop = in.read<bool>();
+            }
+        });
+}
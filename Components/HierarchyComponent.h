@@ -0,0 +1,46 @@
+#pragma once
+#include "../ECS.h"
+#include "../Utils/Vector2D.h"
+
+/*
+ * ============================================================================
+ * HierarchyComponent - Attache une entité à un parent
+ * ============================================================================
+ * L'entité suit son parent (arme, chapeau, ancre d'UI...): son TransformComponent
+ * devient un cache de la transformation monde, recalculé par TransformSystem
+ * à partir de celle du parent et du décalage local ci-dessous.
+ *
+ * Le TransformComponent de l'enfant ne doit donc plus être modifié à la main:
+ * modifier le décalage local (getComponent non const: TransformSystem le voit).
+ *
+ * Si le parent est détruit, l'enfant reste à sa dernière position.
+ *
+ * Usage:
+ *   auto& sword = manager.createEntity();
+ *   sword.addComponent<TransformComponent>();
+ *   sword.addComponent<HierarchyComponent>(player.getHandle(), 12.0f, -4.0f);
+ *
+ *   // Plus tard:
+ *   sword.getComponent<HierarchyComponent>().localRotation = 45.0f;
+ * ============================================================================
+ */
+
+class HierarchyComponent : public ECS::Component
+{
+public:
+    ECS::EntityHandle parent;
+
+    // Relatifs au parent: décalage dans son repère (tourné et mis à l'échelle avec lui)
+    Vector2D localPosition;
+    float localRotation;
+    float localScale;
+
+    HierarchyComponent()
+        : localPosition(0, 0), localRotation(0.0f), localScale(1.0f) {}
+
+    HierarchyComponent(ECS::EntityHandle parentHandle, float x = 0.0f, float y = 0.0f)
+        : parent(parentHandle), localPosition(x, y), localRotation(0.0f), localScale(1.0f) {}
+
+    HierarchyComponent(ECS::EntityHandle parentHandle, float x, float y, float rot, float s = 1.0f)
+        : parent(parentHandle), localPosition(x, y), localRotation(rot), localScale(s) {}
+};
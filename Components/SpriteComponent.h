@@ -7,7 +7,7 @@ class SpriteComponent : public ECS::Component {
 public:
     SDL_Texture* texture = nullptr;
     SDL_Rect srcRect;  // Source dans la texture
-    SDL_Rect dstRect;  // Destination à l'écran
+    SDL_Rect dstRect;  // Destination à l'écran (écrite par RenderSystem quand elle change)
     
     int width = 0;
     int height = 0;
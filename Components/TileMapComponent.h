@@ -14,6 +14,7 @@ struct TileSet
     int columns;
     int tileCount;
     SDL_Texture *texture;
+    std::string imagePath; // Image chargée dans texture
 
     TileSet()
         : firstGID(0),
@@ -37,6 +38,27 @@ struct TileSet
 
         return rect;
     }
+
+    /*
+     * Mémoire possédée (voir ECS::heapBytes): le chemin, et la texture estimée
+     * à largeur x hauteur x octets par pixel (elle vit dans SDL ou le GPU)
+     */
+    std::size_t memoryUsage() const
+    {
+        return ECS::heapBytes(imagePath) + textureBytes();
+    }
+
+    std::size_t textureBytes() const
+    {
+        Uint32 format = 0;
+        int w = 0;
+        int h = 0;
+        if (!texture || SDL_QueryTexture(texture, &format, nullptr, &w, &h) != 0)
+        {
+            return 0;
+        }
+        return static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * SDL_BYTESPERPIXEL(format);
+    }
 };
 
 struct Layer
@@ -70,6 +92,12 @@ struct Layer
         int index = y * width + x;
         tiles[index] = tileId;
     }
+
+    // Octets sur le heap (voir ECS::heapBytes)
+    std::size_t memoryUsage() const
+    {
+        return ECS::heapBytes(name) + ECS::heapBytes(tiles);
+    }
 };
 
 struct TiledObject {
@@ -95,6 +123,11 @@ struct TiledObject {
         return (it != properties.end()) ? it->second : "";
     }
 
+    // Octets sur le heap (voir ECS::heapBytes)
+    std::size_t memoryUsage() const {
+        return ECS::heapBytes(name) + ECS::heapBytes(type) + ECS::heapBytes(objectGroup) + ECS::heapBytes(properties);
+    }
+
     void print() const {
         std::cout << "[TiledObject] " << objectGroup << "/" << type 
                   << " '" << name << "' at (" << x << ", " << y 
@@ -136,6 +169,18 @@ public:
         return result;
     }
 
+    // Versions const: lecture via getComponent<const TileMapComponent>() (systèmes Access::Read)
+    const TileSet *getTilesetFromGID(int gid) const
+    {
+        const TileSet *result = nullptr;
+        for (const auto &ts : tilesets)
+        {
+            if (gid >= ts.firstGID)
+                result = &ts;
+        }
+        return result;
+    }
+
     std::vector<TiledObject*> getObjectsByGroup(const std::string& group)  {
         std::vector<TiledObject*> result;
         for (auto& obj : objects){
@@ -146,6 +191,16 @@ public:
         return result;
     }
 
+    std::vector<const TiledObject*> getObjectsByGroup(const std::string& group) const {
+        std::vector<const TiledObject*> result;
+        for (const auto& obj : objects){
+            if (obj.objectGroup == group){
+                result.push_back(&obj);
+            }
+        }
+        return result;
+    }
+
     std::vector<TiledObject*> getObjectsByType(const std::string& type)  {
         std::vector<TiledObject*> result;
         for (auto& obj : objects){
@@ -186,6 +241,39 @@ public:
         return mapHeight * tileHeight;
     }
 
+    /*
+     * Mémoire de la map, textures des tilesets comprises
+     * (comptée par Manager::sampleMemory, en composant ou en ressource)
+     */
+    std::size_t memoryUsage() const {
+        return ECS::heapBytes(tilesets) + ECS::heapBytes(layers) + ECS::heapBytes(objects);
+    }
+
+    /*
+     * Détail de memoryUsage(): chaque layer, puis les objets et leurs propriétés
+     * Pour trouver ce qui fait dépasser le budget d'une map
+     */
+    void printMemoryUsage() const {
+        std::size_t propertyCount = 0;
+        std::size_t propertyBytes = 0;
+        for (const auto& obj : objects) {
+            propertyCount += obj.properties.size();
+            propertyBytes += ECS::heapBytes(obj.properties);
+        }
+
+        std::cout << "[TileMap] " << memoryUsage() << " bytes (" << mapWidth << "x" << mapHeight << " tiles)\n";
+        for (const auto& layer : layers) {
+            std::cout << "  layer '" << layer.name << "' " << layer.width << "x" << layer.height
+                      << ": " << layer.memoryUsage() << " bytes\n";
+        }
+        std::cout << "  " << objects.size() << " objects: " << ECS::heapBytes(objects) << " bytes, including "
+                  << propertyCount << " properties: " << propertyBytes << " bytes\n";
+        std::cout << "  " << tilesets.size() << " tilesets: " << ECS::heapBytes(tilesets) << " bytes\n";
+        for (const auto& ts : tilesets) {
+            std::cout << "    '" << ts.imagePath << "': " << ts.textureBytes() << " bytes of texture\n";
+        }
+    }
+
 
 
 };
\ No newline at end of file
@@ -11,18 +11,72 @@ public:
     float scale;
     float rotation;  
 
+    // État au pas précédent (MovementSystem), pour interpoler le rendu
+    Vector2D previousPosition;
+    float previousRotation;
+
+    // État laissé par le dernier pas (voir endStep): si position ou rotation en
+    // diffèrent, elles ont été écrites directement et ne sont pas interpolées
+    Vector2D steppedPosition;
+    float steppedRotation;
+
     TransformComponent()
-        : position(0, 0), velocity(0, 0), scale(1.0f), rotation(0.0f) {}
+        : position(0, 0), velocity(0, 0), scale(1.0f), rotation(0.0f), previousPosition(0, 0), previousRotation(0.0f),
+          steppedPosition(0, 0), steppedRotation(0.0f) {}
 
 
     TransformComponent(float x, float y)
-        : position(x, y), velocity(0, 0), scale(1.0f), rotation(0.0f) {}
+        : position(x, y), velocity(0, 0), scale(1.0f), rotation(0.0f), previousPosition(x, y), previousRotation(0.0f),
+          steppedPosition(x, y), steppedRotation(0.0f) {}
 
     TransformComponent(float x, float y, float s)
-        : position(x, y), velocity(0, 0), scale(s), rotation(0.0f) {}
+        : position(x, y), velocity(0, 0), scale(s), rotation(0.0f), previousPosition(x, y), previousRotation(0.0f),
+          steppedPosition(x, y), steppedRotation(0.0f) {}
 
 
     TransformComponent(float x, float y, float s, float rot)
-        : position(x, y), velocity(0, 0), scale(s), rotation(rot) {}
+        : position(x, y), velocity(0, 0), scale(s), rotation(rot), previousPosition(x, y), previousRotation(rot),
+          steppedPosition(x, y), steppedRotation(rot) {}
+
+    /*
+     * Déplace l'entité sans interpolation depuis l'ancienne position
+     * (spawn, téléportation...): sinon le rendu la ferait glisser jusqu'à la nouvelle
+     */
+    void teleport(float x, float y)
+    {
+        position = Vector2D(x, y);
+        previousPosition = position;
+        previousRotation = rotation;
+        endStep();
+    }
+
+    // Appelé par les systèmes qui avancent le transform d'un pas (après écriture)
+    void endStep()
+    {
+        steppedPosition = position;
+        steppedRotation = rotation;
+    }
+
+    // Faux après une écriture directe de position/rotation depuis le dernier pas
+    bool isInStep() const { return position == steppedPosition && rotation == steppedRotation; }
+
+    bool isInterpolating() const { return isInStep() && (previousPosition != position || previousRotation != rotation); }
+
+    // Position entre le pas précédent (alpha = 0) et le courant (alpha = 1)
+    // Écrite directement (spawn, téléportation...): dessinée telle quelle, sans glisser
+    Vector2D interpolatedPosition(float alpha) const
+    {
+        if (!isInStep())
+            return position;
+        return previousPosition + (position - previousPosition) * alpha;
+    }
 
+    // Rotation interpolée par le plus court chemin (359° -> 1° passe par 0°)
+    float interpolatedRotation(float alpha) const
+    {
+        if (!isInStep())
+            return rotation;
+        float delta = std::fmod(rotation - previousRotation + 540.0f, 360.0f) - 180.0f;
+        return previousRotation + delta * alpha;
+    }
 };
\ No newline at end of file
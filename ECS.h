@@ -30,7 +30,45 @@
 #include <string>
 #include <typeindex>
 #include <set>
+#include <map>
+#include <iomanip>
+#include <mutex>
+#include <shared_mutex>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <atomic>
+#include <functional>
+#include <tuple>
+#include <deque>
+#include <cmath>
+#include <fstream>
+#include <cstring>
 #include <SDL2/SDL.h>
+#include "Utils/ThreadPool.h"
+#include "Utils/BinaryStream.h"
+#include "Utils/Profiler.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Nombre de types de composants différents supportés (voir MAX_COMPONENTS)
+#ifndef ECS_MAX_COMPONENTS
+#define ECS_MAX_COMPONENTS 256
+#endif
+
+// ComponentBitSet::containsAll en AVX2 si disponible (0: boucle scalaire, voir Tests/ComponentBitSetBenchmark.cpp)
+#ifndef ECS_BITSET_SIMD
+#define ECS_BITSET_SIMD 1
+#endif
 
 namespace ECS
 {
@@ -53,14 +91,222 @@ namespace ECS
     // ID unique pour chaque entit�
     using EntityID = std::size_t;
 
+    /*
+     * Référence sûre vers une entité: index de slot (32 bits) + génération
+     * Quand une entité est détruite, la génération de son slot augmente:
+     * un handle périmé ne résout plus vers rien (au lieu d'un Entity* invalide)
+     *
+     * Exemple:
+     *   ECS::EntityHandle target = player.getHandle();
+     *   if (ECS::Entity *entity = manager.getEntity(target)) { ... }
+     */
+    struct EntityHandle
+    {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        std::uint32_t index = INVALID_INDEX;
+        std::uint32_t generation = 0;
+
+        bool isNull() const { return index == INVALID_INDEX; }
+
+        bool operator==(const EntityHandle &other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+    };
+
     // Nombre maximum de composants diff�rents (peut �tre augment� si n�cessaire)
-    constexpr std::size_t MAX_COMPONENTS = 64;
+    // Choisi à la compilation: -DECS_MAX_COMPONENTS=512 (multiple de 64)
+    constexpr std::size_t MAX_COMPONENTS = ECS_MAX_COMPONENTS;
+    static_assert(MAX_COMPONENTS > 0 && MAX_COMPONENTS % 64 == 0, "ECS_MAX_COMPONENTS doit être un multiple de 64");
+
+    namespace Internal
+    {
+        inline unsigned countTrailingZeros(std::uint64_t word)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+        }
+    }
+
+    /*
+     * Bitset pour savoir quels composants une entit� poss�de (rapide et efficace)
+     * Tableau de mots de 64 bits: le test d'une signature reste quelques AND/comparaisons
+     * (256 bits à la fois avec AVX2), quel que soit MAX_COMPONENTS
+     */
+    class ComponentBitSet
+    {
+    public:
+        static constexpr std::size_t WORD_COUNT = MAX_COMPONENTS / 64;
+
+    private:
+        std::uint64_t words[WORD_COUNT] = {};
+
+    public:
+        ComponentBitSet &set(std::size_t id)
+        {
+            words[id >> 6] |= std::uint64_t(1) << (id & 63);
+            return *this;
+        }
+
+        ComponentBitSet &reset(std::size_t id)
+        {
+            words[id >> 6] &= ~(std::uint64_t(1) << (id & 63));
+            return *this;
+        }
+
+        ComponentBitSet &reset()
+        {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                words[i] = 0;
+            }
+            return *this;
+        }
+
+        bool test(std::size_t id) const { return (words[id >> 6] >> (id & 63)) & 1; }
+        bool operator[](std::size_t id) const { return test(id); }
+
+        bool any() const
+        {
+            std::uint64_t bits = 0;
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                bits |= words[i];
+            }
+            return bits != 0;
+        }
+
+        bool none() const { return !any(); }
+
+        std::size_t count() const
+        {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                total += std::bitset<64>(words[i]).count();
+            }
+            return total;
+        }
+
+        /*
+         * Vrai si tous les bits de mask sont présents: équivalent de (*this & mask) == mask
+         * sans construire de bitset temporaire
+         */
+        bool containsAll(const ComponentBitSet &mask) const
+        {
+#if ECS_BITSET_SIMD && defined(__AVX2__)
+            if constexpr (WORD_COUNT % 4 == 0)
+            {
+                for (std::size_t i = 0; i < WORD_COUNT; i += 4)
+                {
+                    __m256i have = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+                    __m256i need = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask.words + i));
+                    __m256i missing = _mm256_andnot_si256(have, need);
+                    if (!_mm256_testz_si256(missing, missing))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+#endif
+            // SSE2 n'apporte rien face à cette boucle (mesuré): pas de version 128 bits
+            std::uint64_t missing = 0;
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                missing |= mask.words[i] & ~words[i];
+            }
+            return missing == 0;
+        }
+
+        // Vrai si au moins un bit en commun: équivalent de (*this & other).any()
+        bool intersects(const ComponentBitSet &other) const
+        {
+            std::uint64_t common = 0;
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                common |= words[i] & other.words[i];
+            }
+            return common != 0;
+        }
+
+        /*
+         * Appelle func(ComponentID) pour chaque bit à 1, dans l'ordre croissant
+         * Saute les mots vides: ne coûte pas MAX_COMPONENTS tests
+         */
+        template <typename Func>
+        void forEach(Func &&func) const
+        {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                for (std::uint64_t word = words[i]; word != 0; word &= word - 1)
+                {
+                    func(static_cast<ComponentID>(i * 64 + Internal::countTrailingZeros(word)));
+                }
+            }
+        }
+
+        ComponentBitSet &operator&=(const ComponentBitSet &other)
+        {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                words[i] &= other.words[i];
+            }
+            return *this;
+        }
+
+        ComponentBitSet &operator|=(const ComponentBitSet &other)
+        {
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                words[i] |= other.words[i];
+            }
+            return *this;
+        }
+
+        friend ComponentBitSet operator&(ComponentBitSet a, const ComponentBitSet &b) { return a &= b; }
+        friend ComponentBitSet operator|(ComponentBitSet a, const ComponentBitSet &b) { return a |= b; }
+
+        bool operator==(const ComponentBitSet &other) const
+        {
+            std::uint64_t diff = 0;
+            for (std::size_t i = 0; i < WORD_COUNT; ++i)
+            {
+                diff |= words[i] ^ other.words[i];
+            }
+            return diff == 0;
+        }
+
+        bool operator!=(const ComponentBitSet &other) const { return !(*this == other); }
+
+        // Pour les unordered_map indexées par signature
+        struct Hash
+        {
+            std::size_t operator()(const ComponentBitSet &bits) const
+            {
+                std::uint64_t hash = 0xcbf29ce484222325ull;
+                for (std::size_t i = 0; i < WORD_COUNT; ++i)
+                {
+                    hash = (hash ^ bits.words[i]) * 0x100000001b3ull;
+                    hash ^= hash >> 29;
+                }
+                return static_cast<std::size_t>(hash);
+            }
+        };
+    };
 
-    // Bitset pour savoir quels composants une entit� poss�de (rapide et efficace)
-    using ComponentBitSet = std::bitset<MAX_COMPONENTS>;
+    // Parcours parallèles: taille d'un lot, et nombre d'entités en dessous duquel
+    // on reste séquentiel (le coût des threads dépasserait le gain)
+    constexpr std::size_t DEFAULT_GRAIN_SIZE = 256;
+    constexpr std::size_t DEFAULT_PARALLEL_THRESHOLD = 2048;
 
-    // Array pour acc�der rapidement aux composants par leur ID
-    using ComponentArray = std::array<Component *, MAX_COMPONENTS>;
+    // Pas fixes rattrapés au plus par frame: au-delà, le retard est abandonné
+    // (évite la spirale où chaque frame lente en rend la suivante plus lente)
+    constexpr std::size_t DEFAULT_MAX_FIXED_STEPS = 5;
 
     // ========================================================================
     // LAYER SYSTEM
@@ -83,6 +329,89 @@ namespace ECS
     constexpr std::size_t MAX_LAYERS = 32;
     using LayerBitSet = std::bitset<MAX_LAYERS>;
 
+    // ========================================================================
+    // MEMORY ACCOUNTING
+    // ========================================================================
+
+    /*
+     * Octets possédés par un objet hors de son sizeof: heap, mais aussi
+     * textures ou autres assets qu'il est seul à posséder (voir Manager::sampleMemory)
+     *
+     * Un composant, une ressource (ou tout type rangé dans un conteneur) qui
+     * possède de la mémoire le déclare avec une méthode memoryUsage():
+     *   struct Inventory : ECS::Component {
+     *       std::vector<Item> items;
+     *       std::size_t memoryUsage() const { return ECS::heapBytes(items); }
+     *   };
+     *
+     * Estimations: les en-têtes d'allocation ne sont pas comptés, et un noeud
+     * de std::map est compté comme sa valeur plus 4 pointeurs (libstdc++/libc++)
+     */
+    template <typename T, typename = void>
+    struct HasMemoryUsage : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct HasMemoryUsage<T, std::void_t<decltype(std::declval<const T &>().memoryUsage())>> : std::true_type
+    {
+    };
+
+    // Déclarées d'abord: les conteneurs imbriqués s'appellent entre eux
+    template <typename T>
+    std::size_t heapBytes(const T &value);
+    inline std::size_t heapBytes(const std::string &text);
+    template <typename T, typename A>
+    std::size_t heapBytes(const std::vector<T, A> &values);
+    template <typename K, typename V, typename C, typename A>
+    std::size_t heapBytes(const std::map<K, V, C, A> &values);
+
+    template <typename T>
+    std::size_t heapBytes(const T &value)
+    {
+        if constexpr (HasMemoryUsage<T>::value)
+        {
+            return value.memoryUsage();
+        }
+        else
+        {
+            (void)value;
+            return 0;
+        }
+    }
+
+    inline std::size_t heapBytes(const std::string &text)
+    {
+        // Les chaînes courtes sont stockées dans l'objet lui-même (SSO)
+        static const std::size_t inlineCapacity = std::string().capacity();
+        return text.capacity() > inlineCapacity ? text.capacity() + 1 : 0;
+    }
+
+    template <typename T, typename A>
+    std::size_t heapBytes(const std::vector<T, A> &values)
+    {
+        std::size_t bytes = values.capacity() * sizeof(T);
+        if constexpr (HasMemoryUsage<T>::value || !std::is_trivially_copyable<T>::value)
+        {
+            for (const T &value : values)
+            {
+                bytes += heapBytes(value);
+            }
+        }
+        return bytes;
+    }
+
+    template <typename K, typename V, typename C, typename A>
+    std::size_t heapBytes(const std::map<K, V, C, A> &values)
+    {
+        std::size_t bytes = values.size() * (sizeof(typename std::map<K, V, C, A>::value_type) + 4 * sizeof(void *));
+        for (const auto &entry : values)
+        {
+            bytes += heapBytes(entry.first) + heapBytes(entry.second);
+        }
+        return bytes;
+    }
+
     // ========================================================================
     // COMPONENT ID GENERATOR
     // ========================================================================
@@ -91,40 +420,226 @@ namespace ECS
      * G�n�re un ID unique pour chaque TYPE de composant
      * Utilise std::type_index pour garantir l'unicit� m�me entre diff�rentes
      * unit�s de compilation (r�sout le probl�me des static dans les templates)
+     * Le static local de getComponentTypeID ne sert que de cache devant ce registre
      */
     namespace Internal
     {
-        inline ComponentID getUniqueComponentID()
+        /*
+         * Remplace un objet vivant par une nouvelle valeur (composant, ressource)
+         * Par affectation: si elle lève, target reste un objet valide, détruit
+         * une seule fois. Les types non affectables doivent se déplacer sans lever
+         */
+        template <typename T>
+        void replaceValue(T &target, T &&value)
+        {
+            if constexpr (std::is_move_assignable<T>::value)
+            {
+                target = std::move(value);
+            }
+            else
+            {
+                static_assert(std::is_nothrow_move_constructible<T>::value,
+                              "Remplacement impossible: type ni affectable ni déplaçable sans exception");
+                target.~T();
+                new (&target) T(std::move(value));
+            }
+        }
+
+        /*
+         * Opérations sur un type de composant sans connaître T
+         * (nécessaire pour déplacer une ligne d'un archetype à un autre)
+         */
+        struct ComponentInfo
+        {
+            std::size_t size = 0;
+            std::size_t alignment = 0;
+            void (*moveConstruct)(void *dst, void *src) = nullptr;
+            void (*destroy)(void *ptr) = nullptr;
+            Component *(*asComponent)(void *ptr) = nullptr;
+            const char *typeName = nullptr; // typeid(T).name() (décoré sous GCC/Clang)
+
+            // Octets sur le heap d'un composant (nullptr: le type n'a pas de memoryUsage())
+            std::size_t (*heapBytes)(const void *ptr) = nullptr;
+
+            // Copie count composants contigus et les rattache à owners (nullptr si non copiable)
+            void (*copyRange)(void *dst, const void *src, std::size_t count, Entity *const *owners) = nullptr;
+        };
+
+        template <typename T>
+        ComponentInfo makeComponentInfo()
+        {
+            ComponentInfo info;
+            info.size = sizeof(T);
+            info.alignment = alignof(T);
+            info.moveConstruct = [](void *dst, void *src)
+            { new (dst) T(std::move(*static_cast<T *>(src))); };
+            info.destroy = [](void *ptr)
+            { static_cast<T *>(ptr)->~T(); };
+            info.asComponent = [](void *ptr) -> Component *
+            { return static_cast<T *>(ptr); };
+            info.typeName = typeid(T).name();
+            if constexpr (HasMemoryUsage<T>::value)
+            {
+                info.heapBytes = [](const void *ptr) -> std::size_t
+                { return static_cast<const T *>(ptr)->memoryUsage(); };
+            }
+            if constexpr (std::is_copy_constructible<T>::value)
+            {
+                info.copyRange = [](void *dst, const void *src, std::size_t count, Entity *const *owners)
+                {
+                    T *target = static_cast<T *>(dst);
+                    const T *source = static_cast<const T *>(src);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        new (target + i) T(source[i]);
+                        target[i].entity = owners[i];
+                    }
+                };
+            }
+            return info;
+        }
+
+        /*
+         * Registre global: type -> ID + infos de type
+         * Protégé par un mutex, mais consulté une seule fois par type
+         * (voir getComponentTypeID)
+         */
+        struct ComponentRegistry
+        {
+            std::mutex mutex;
+            std::unordered_map<std::type_index, ComponentID> typeMap;
+            std::array<ComponentInfo, MAX_COMPONENTS> infos{}; // Taille fixe: jamais réalloué
+        };
+
+        inline ComponentRegistry &getComponentRegistry()
+        {
+            static ComponentRegistry registry;
+            return registry;
+        }
+
+        template <typename T>
+        ComponentID registerComponentType()
         {
-            static ComponentID lastID = 0;
-            return lastID++;
+            auto &registry = getComponentRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            auto it = registry.typeMap.find(std::type_index(typeid(T)));
+            if (it != registry.typeMap.end())
+            {
+                return it->second;
+            }
+
+            // Refusé avant d'être enregistré: aucun ID ne peut déborder d'un ComponentBitSet
+            // (System::requireComponent, Entity::addComponent, sérialisation...)
+            ComponentID id = registry.typeMap.size();
+            if (id >= MAX_COMPONENTS)
+            {
+                throw std::runtime_error("MAX_COMPONENTS exceeded! (augmenter ECS_MAX_COMPONENTS)");
+            }
+            registry.infos[id] = makeComponentInfo<T>();
+            registry.typeMap.emplace(std::type_index(typeid(T)), id);
+            return id;
         }
 
-        // Map globale: type -> ID (thread-safe en C++11+)
-        inline std::unordered_map<std::type_index, ComponentID> &getComponentTypeMap()
+        inline const ComponentInfo &getComponentInfo(ComponentID id)
         {
-            static std::unordered_map<std::type_index, ComponentID> typeMap;
-            return typeMap;
+            return getComponentRegistry().infos[id];
         }
     }
 
     /*
-     * R�cup�re l'ID d'un type de composant
-     * Cr�e un nouvel ID si c'est la premi�re fois qu'on voit ce type
+     * Récupère l'ID d'un type de composant
+     * Le registre n'est consulté qu'au premier appel pour chaque type: ensuite
+     * l'ID est une constante (static local, initialisation thread-safe depuis C++11)
+     * et hasComponent/getComponent se résument à un accès tableau
+     * Lève std::runtime_error si le type dépasse MAX_COMPONENTS
      */
     template <typename T>
     inline ComponentID getComponentTypeID()
     {
-        std::type_index typeIdx(typeid(T));
-        auto &typeMap = Internal::getComponentTypeMap();
+        static const ComponentID id = Internal::registerComponentType<std::remove_cv_t<T>>();
+        return id;
+    }
+
+    // ========================================================================
+    // TAG REGISTRY
+    // ========================================================================
+
+    /*
+     * Chaque chaîne de tag est internée une seule fois en un petit entier (TagID)
+     * Les comparaisons deviennent des comparaisons d'entiers, et le Manager peut
+     * indexer ses entités par tag dans un simple tableau
+     *
+     * Les lectures (findTagID, getTagName, requêtes par chaîne) n'internent rien:
+     * chercher un tag que personne n'a posé ne fait pas grossir le registre
+     *
+     * Exemple:
+     *   static const ECS::TagID ENEMY = ECS::getTagID("Enemy");
+     *   if (entity.hasTag(ENEMY)) { ... }
+     */
+    using TagID = std::uint32_t;
+    constexpr TagID NO_TAG = 0;                // Chaîne vide
+    constexpr TagID INVALID_TAG = 0xFFFFFFFFu; // Chaîne jamais internée (voir findTagID)
+
+    namespace Internal
+    {
+        struct TagRegistry
+        {
+            std::shared_mutex mutex; // Lectures concurrentes, verrou exclusif pour interner
+            std::unordered_map<std::string, TagID> ids;
+            std::deque<std::string> names{std::string()}; // deque: références stables
+
+            TagRegistry() { ids.emplace(std::string(), NO_TAG); }
+        };
+
+        inline TagRegistry &getTagRegistry()
+        {
+            static TagRegistry registry;
+            return registry;
+        }
+    }
+
+    // ID du tag s'il a déjà été interné, INVALID_TAG sinon (n'ajoute rien), thread-safe
+    inline TagID findTagID(const std::string &name)
+    {
+        Internal::TagRegistry &registry = Internal::getTagRegistry();
+        std::shared_lock<std::shared_mutex> lock(registry.mutex);
+
+        auto it = registry.ids.find(name);
+        return it != registry.ids.end() ? it->second : INVALID_TAG;
+    }
+
+    // Retourne l'ID du tag (créé au premier appel pour cette chaîne), thread-safe
+    inline TagID getTagID(const std::string &name)
+    {
+        TagID known = findTagID(name);
+        if (known != INVALID_TAG)
+        {
+            return known;
+        }
+
+        Internal::TagRegistry &registry = Internal::getTagRegistry();
+        std::unique_lock<std::shared_mutex> lock(registry.mutex);
 
-        // Si ce type n'a pas encore d'ID, on lui en attribue un
-        if (typeMap.find(typeIdx) == typeMap.end())
+        // Un autre thread a pu l'interner entre les deux verrous
+        auto it = registry.ids.find(name);
+        if (it != registry.ids.end())
         {
-            typeMap[typeIdx] = Internal::getUniqueComponentID();
+            return it->second;
         }
 
-        return typeMap[typeIdx];
+        TagID id = static_cast<TagID>(registry.names.size());
+        registry.names.push_back(name);
+        registry.ids.emplace(name, id);
+        return id;
+    }
+
+    // Chaîne d'un tag interné (chaîne vide pour INVALID_TAG)
+    inline const std::string &getTagName(TagID id)
+    {
+        Internal::TagRegistry &registry = Internal::getTagRegistry();
+        std::shared_lock<std::shared_mutex> lock(registry.mutex);
+        return id < registry.names.size() ? registry.names[id] : registry.names[NO_TAG];
     }
 
     // ========================================================================
@@ -149,93 +664,646 @@ namespace ECS
     };
 
     // ========================================================================
-    // ENTITY CLASS
+    // COMPONENT SERIALIZATION
     // ========================================================================
 
     /*
-     * Une entit� est simplement un conteneur de composants avec un ID unique
-     * Elle ne contient pas de logique, juste des donn�es (composants)
+     * Les snapshots (Manager::saveSnapshot/loadSnapshot) ne contiennent que les
+     * composants enregistrés ici, sous un nom stable: l'ID d'un type dépend de
+     * l'ordre des premiers appels et peut changer d'une exécution à l'autre
+     *
+     * Deux modes:
+     * - Raw: les champs listés sont copiés tels quels (memcpy), colonne par colonne.
+     *   Uniquement des champs "plats" (nombres, Vector2D, SDL_Rect...): vérifié à la
+     *   compilation, un std::string, un conteneur ou un pointeur est refusé
+     * - Custom: save/load écrivent et relisent les champs un par un
+     *
+     * Un composant non enregistré n'est pas sauvegardé (l'entité l'est, sans lui)
+     * Le composant est construit par défaut au chargement, puis rempli
+     *
+     * Exemple:
+     *   ECS::registerComponent<TransformComponent>("Transform",
+     *       &TransformComponent::position, &TransformComponent::velocity, ...);
+     *   ECS::registerComponent<CollisionComponent>("Collision",
+     *       [](const CollisionComponent &c, BinaryWriter &out) { out.writeString(c.getTag()); ... },
+     *       [](CollisionComponent &c, BinaryReader &in) { c.setTag(in.readString()); ... });
      */
-    class Entity
+    enum class SerializeMode : std::uint8_t
     {
-    private:
-        Manager *manager = nullptr;
-        EntityID id = 0;
-        bool active = true;
-        std::string tag = "";
-        LayerBitSet layers;
+        Raw,
+        Custom
+    };
 
-        // Stockage des composants
-        std::vector<std::unique_ptr<Component>> components;
-        ComponentArray componentArray{};
-        ComponentBitSet componentBitSet;
+    namespace Internal
+    {
+        // Champ copié en mode Raw: position dans le composant et taille
+        struct RawField
+        {
+            std::size_t offset;
+            std::size_t size;
+        };
 
-        friend class Manager;
-        friend class System;
+        struct SerializerInfo
+        {
+            std::string name; // Vide: type non enregistré
+            SerializeMode mode = SerializeMode::Raw;
+            std::vector<RawField> rawFields;        // Mode Raw: champs copiés, dans l'ordre
+            std::size_t rawSize = 0;                // Somme des tailles de rawFields (sans padding)
+            void (*construct)(void *ptr) = nullptr; // Construction par défaut avant chargement
+            std::function<void(const void *, BinaryWriter &)> save;
+            std::function<void(void *, BinaryReader &)> load;
+        };
 
-    public:
-        Entity(Manager *mgr, EntityID entityID) : manager(mgr), id(entityID) {}
+        struct SerializerTable
+        {
+            std::array<SerializerInfo, MAX_COMPONENTS> infos;
+            std::unordered_map<std::string, ComponentID> byName;
+        };
 
-        // ====================================================================
-        // LIFECYCLE
-        // ====================================================================
+        struct SerializationRegistry
+        {
+            std::mutex mutex;
+            SerializerTable table;
+        };
 
-        void update()
+        inline SerializationRegistry &getSerializationRegistry()
         {
-            for (auto &c : components)
-            {
-                c->update();
-            }
+            static SerializationRegistry registry;
+            return registry;
         }
 
-        void draw()
+        /*
+         * Copie du registre pour un save/load: le mutex n'est pas gardé pendant les
+         * serializers, observers et init() (qui peuvent enregistrer un composant)
+         */
+        inline SerializerTable copySerializers()
         {
-            for (auto &c : components)
-            {
-                c->draw();
-            }
+            SerializationRegistry &registry = getSerializationRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            return registry.table;
         }
 
-        bool isActive() const { return active; }
-        void destroy() { active = false; }
-        EntityID getID() const { return id; }
+        template <typename T>
+        void registerSerializer(const std::string &name, SerializeMode mode,
+                                std::function<void(const void *, BinaryWriter &)> save,
+                                std::function<void(void *, BinaryReader &)> load,
+                                std::vector<RawField> rawFields = {})
+        {
+            static_assert(std::is_base_of<Component, T>::value, "Un composant doit hériter de ECS::Component");
+            static_assert(std::is_default_constructible<T>::value, "Un composant sérialisé doit être constructible par défaut");
 
-        // ====================================================================
-        // TAG SYSTEM
-        // ====================================================================
+            ComponentID id = getComponentTypeID<T>();
 
-        /*
-         * Un tag est un identifiant unique (string) pour cette entit�
-         * Utile pour retrouver rapidement des entit�s sp�cifiques (Player, Boss, etc.)
-         */
-        void setTag(const std::string &t) { tag = t; }
-        const std::string &getTag() const { return tag; }
-        bool hasTag(const std::string &t) const { return tag == t; }
+            SerializationRegistry &registry = getSerializationRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
 
-        // ====================================================================
-        // LAYER SYSTEM
-        // ====================================================================
+            SerializerInfo &info = registry.table.infos[id];
+            if (!info.name.empty())
+            {
+                registry.table.byName.erase(info.name);
+            }
+            info.name = name;
+            info.mode = mode;
+            info.rawSize = 0;
+            for (const RawField &field : rawFields)
+            {
+                info.rawSize += field.size;
+            }
+            info.rawFields = std::move(rawFields);
+            info.construct = [](void *ptr)
+            { new (ptr) T(); };
+            info.save = std::move(save);
+            info.load = std::move(load);
+            registry.table.byName[name] = id;
+        }
+    }
+
+    /*
+     * Enregistre T en mode Raw: les champs listés sont copiés tels quels
+     * Exemple: ECS::registerComponent<HealthComponent>("Health", &HealthComponent::hp, &HealthComponent::maxHp);
+     */
+    template <typename T, typename... Fields>
+    void registerComponent(const std::string &name, Fields T::*...fields)
+    {
+        static_assert(sizeof...(Fields) > 0, "Mode Raw: lister les champs copiés (ex: &T::position)");
+        static_assert((std::is_trivially_copyable<Fields>::value && ...),
+                      "Mode Raw: champs trivialement copiables uniquement (std::string, conteneurs: mode Custom)");
+        static_assert((!std::is_pointer<Fields>::value && ...),
+                      "Mode Raw: un pointeur ne survit pas à un rechargement (mode Custom)");
+
+        // Position de chaque champ, mesurée sur une instance
+        T sample;
+        const std::byte *base = reinterpret_cast<const std::byte *>(&sample);
+        std::vector<Internal::RawField> rawFields{
+            {static_cast<std::size_t>(reinterpret_cast<const std::byte *>(&(sample.*fields)) - base), sizeof(Fields)}...};
+        Internal::registerSerializer<T>(name, SerializeMode::Raw, nullptr, nullptr, std::move(rawFields));
+    }
+
+    // Enregistre T avec ses propres fonctions d'écriture/lecture
+    template <typename T>
+    void registerComponent(const std::string &name,
+                           std::function<void(const T &, BinaryWriter &)> save,
+                           std::function<void(T &, BinaryReader &)> load)
+    {
+        Internal::registerSerializer<T>(
+            name, SerializeMode::Custom,
+            [save](const void *component, BinaryWriter &out)
+            { save(*static_cast<const T *>(component), out); },
+            [load](void *component, BinaryReader &in)
+            { load(*static_cast<T *>(component), in); });
+    }
+
+    // ========================================================================
+    // ARCHETYPE STORAGE
+    // ========================================================================
+
+    /*
+     * Les composants ne sont plus alloués un par un avec new:
+     * toutes les entités qui ont exactement le même ComponentBitSet partagent
+     * un Archetype, découpé en chunks de taille fixe (CHUNK_SIZE).
+     *
+     * Dans un chunk, chaque type de composant a son propre tableau contigu (SoA):
+     *
+     *   chunk: [Entity* x N][TransformComponent x N][SpriteComponent x N]
+     *
+     * Parcourir un type de composant revient donc à lire de la mémoire linéaire
+     * au lieu de suivre des pointeurs éparpillés sur le heap.
+     *
+     * Chaque colonne a aussi un tableau de "ticks" (uint32): le tick du Manager
+     * au moment du dernier accès modifiable au composant (getComponent<T>, View
+     * sur T non const, markChanged), pour ne retraiter que ce qui a changé.
+     *
+     * ATTENTION: ajouter/retirer un composant déplace l'entité dans un autre
+     * archetype, et détruire une entité déplace la dernière ligne de son archetype.
+     * Ne gardez pas de pointeur vers un composant d'une frame à l'autre.
+     */
+    /*
+     * Statistiques de l'allocateur de chunks (voir Manager::getAllocatorStats)
+     */
+    struct AllocatorStats
+    {
+        std::size_t blockCount = 0;       // Gros blocs demandés au système
+        std::size_t reservedBytes = 0;    // Mémoire totale réservée par ces blocs
+        std::size_t chunksInUse = 0;      // Chunks actuellement utilisés par des archetypes
+        std::size_t peakChunksInUse = 0;  // Maximum atteint de chunksInUse
+        std::size_t chunkAllocations = 0; // Nombre total de chunks distribués
+        std::size_t largeAllocations = 0; // Chunks trop gros pour le pool (alloués à part)
+    };
+
+    /*
+     * Mémoire vivante d'une catégorie (voir Manager::sampleMemory)
+     */
+    struct MemoryUsage
+    {
+        std::string name;
+        std::size_t count = 0;         // Objets vivants (composants, entités, membres d'un système)
+        std::size_t bytes = 0;         // Octets vivants
+        std::size_t peakBytes = 0;     // Maximum de bytes sur tous les samples
+        std::ptrdiff_t deltaBytes = 0; // Variation depuis le sample précédent
+    };
+
+    struct MemoryReport
+    {
+        std::vector<MemoryUsage> components; // Par type: sizeof x nombre + heap (memoryUsage())
+        std::vector<MemoryUsage> systems;    // Liste d'entités de chaque système
+        std::vector<MemoryUsage> resources;  // Par type: sizeof + memoryUsage() (voir setResource)
+        MemoryUsage entities;                // Objets Entity et tables du Manager
+        MemoryUsage chunks;                  // Réservé par l'allocateur (composants, ticks, lignes libres)
+        MemoryUsage total;                   // chunks + heap des composants + ressources + entités + systèmes
+    };
+
+    namespace Internal
+    {
+        // Historique d'une catégorie entre deux Manager::sampleMemory
+        struct MemoryHistory
+        {
+            std::size_t peakBytes = 0;
+            std::size_t lastBytes = 0;
+        };
+
+        inline void recordMemorySample(MemoryUsage &usage, MemoryHistory &history)
+        {
+            usage.deltaBytes = static_cast<std::ptrdiff_t>(usage.bytes) - static_cast<std::ptrdiff_t>(history.lastBytes);
+            history.peakBytes = std::max(history.peakBytes, usage.bytes);
+            history.lastBytes = usage.bytes;
+            usage.peakBytes = history.peakBytes;
+        }
+
+        // Taille d'un chunk: tient dans le cache L1/L2 tout en amortissant l'allocation
+        constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+        constexpr std::size_t CHUNK_ALIGNMENT = 64;
 
         /*
-         * Les layers permettent de grouper les entit�s (une entit� peut avoir plusieurs layers)
-         * Exemple: une entit� peut �tre � la fois Enemy + Renderable + Collidable
+         * Pool de chunks d'un Manager
+         * Les chunks sont découpés dans de gros blocs (taille doublée à chaque bloc,
+         * plafonnée) et recyclés via une free list: charger un niveau de 100k entités
+         * coûte une poignée d'allocations, et détruire/recréer ne touche plus au heap.
+         * Les chunks plus grands que CHUNK_SIZE (composant énorme) sont alloués à part.
+         */
+        class ChunkAllocator
+        {
+        private:
+            static constexpr std::size_t FIRST_BLOCK_CHUNKS = 8;
+            static constexpr std::size_t MAX_BLOCK_CHUNKS = 256; // 4 Mo
+
+            std::vector<std::byte *> blocks;
+            std::vector<std::byte *> freeChunks;
+            std::size_t nextBlockChunks = FIRST_BLOCK_CHUNKS;
+            AllocatorStats stats;
+
+            void allocateBlock()
+            {
+                std::size_t bytes = nextBlockChunks * CHUNK_SIZE;
+                std::byte *block = static_cast<std::byte *>(::operator new(bytes, std::align_val_t(CHUNK_ALIGNMENT)));
+                blocks.push_back(block);
+
+                // Empilés à l'envers pour distribuer les chunks dans l'ordre des adresses
+                for (std::size_t i = nextBlockChunks; i-- > 0;)
+                {
+                    freeChunks.push_back(block + i * CHUNK_SIZE);
+                }
+
+                ++stats.blockCount;
+                stats.reservedBytes += bytes;
+                nextBlockChunks = std::min(nextBlockChunks * 2, MAX_BLOCK_CHUNKS);
+            }
+
+        public:
+            ChunkAllocator() = default;
+            ChunkAllocator(const ChunkAllocator &) = delete;
+            ChunkAllocator &operator=(const ChunkAllocator &) = delete;
+
+            ~ChunkAllocator()
+            {
+                for (std::byte *block : blocks)
+                {
+                    ::operator delete(block, std::align_val_t(CHUNK_ALIGNMENT));
+                }
+            }
+
+            std::byte *allocate(std::size_t bytes)
+            {
+                ++stats.chunkAllocations;
+                stats.peakChunksInUse = std::max(stats.peakChunksInUse, ++stats.chunksInUse);
+
+                if (bytes > CHUNK_SIZE)
+                {
+                    ++stats.largeAllocations;
+                    return static_cast<std::byte *>(::operator new(bytes, std::align_val_t(CHUNK_ALIGNMENT)));
+                }
+
+                if (freeChunks.empty())
+                {
+                    allocateBlock();
+                }
+                std::byte *chunk = freeChunks.back();
+                freeChunks.pop_back();
+                return chunk;
+            }
+
+            void deallocate(std::byte *chunk, std::size_t bytes)
+            {
+                --stats.chunksInUse;
+                if (bytes > CHUNK_SIZE)
+                {
+                    ::operator delete(chunk, std::align_val_t(CHUNK_ALIGNMENT));
+                    return;
+                }
+                freeChunks.push_back(chunk);
+            }
+
+            // Pré-alloue de quoi fournir chunkCount chunks sans nouvel appel au système
+            void reserve(std::size_t chunkCount)
+            {
+                while (freeChunks.size() < chunkCount)
+                {
+                    allocateBlock();
+                }
+            }
+
+            const AllocatorStats &getStats() const { return stats; }
+        };
+
+        struct Chunk
+        {
+            std::byte *data = nullptr; // [Entity* x capacity][colonne 0][colonne 1]...
+            std::size_t count = 0;     // Nombre de lignes occupées
+        };
+
+        /*
+         * Toutes les entités ayant une signature donnée
+         * Les lignes sont toujours compactes: la suppression fait un swap avec la dernière
          */
-        void addLayer(Layer layer)
+        class Archetype
+        {
+        public:
+            struct Column
+            {
+                ComponentID type;
+                std::size_t offset;     // Début du tableau de ce type dans le chunk
+                std::size_t tickOffset; // Début du tableau des ticks de modification
+                ComponentInfo info;
+            };
+
+            ComponentBitSet signature;
+            ChunkAllocator &allocator;
+            std::vector<Column> columns;
+            std::array<int, MAX_COMPONENTS> columnIndex; // Type -> colonne (-1 si absent)
+            std::vector<Chunk> chunks;
+            std::size_t chunkCapacity = 1; // Lignes par chunk
+            std::size_t chunkBytes = CHUNK_SIZE;
+            std::size_t entityCount = 0;
+
+            // Transitions déjà rencontrées: archetype obtenu en ajoutant/retirant un type
+            std::array<Archetype *, MAX_COMPONENTS> addEdges{};
+            std::array<Archetype *, MAX_COMPONENTS> removeEdges{};
+
+            Archetype(const ComponentBitSet &sig, ChunkAllocator &chunkAllocator)
+                : signature(sig), allocator(chunkAllocator)
+            {
+                columnIndex.fill(-1);
+
+                std::size_t rowSize = sizeof(Entity *);
+                signature.forEach([&](ComponentID id)
+                                  {
+                                      columnIndex[id] = static_cast<int>(columns.size());
+                                      columns.push_back({id, 0, 0, getComponentInfo(id)});
+                                      rowSize += getComponentInfo(id).size + sizeof(std::uint32_t); });
+
+                // Autant de lignes que possible dans CHUNK_SIZE (au moins une)
+                chunkCapacity = std::max<std::size_t>(1, CHUNK_SIZE / rowSize);
+                while (chunkCapacity > 1 && computeLayout(chunkCapacity) > CHUNK_SIZE)
+                {
+                    --chunkCapacity;
+                }
+                chunkBytes = std::max(CHUNK_SIZE, computeLayout(chunkCapacity));
+            }
+
+            Archetype(const Archetype &) = delete;
+            Archetype &operator=(const Archetype &) = delete;
+
+            ~Archetype()
+            {
+                clear();
+            }
+
+            // Détruit toutes les lignes et rend les chunks à l'allocateur
+            void clear()
+            {
+                for (auto &chunk : chunks)
+                {
+                    for (std::size_t row = 0; row < chunk.count; ++row)
+                    {
+                        for (auto &column : columns)
+                        {
+                            column.info.destroy(chunk.data + column.offset + row * column.info.size);
+                        }
+                    }
+                    allocator.deallocate(chunk.data, chunkBytes);
+                }
+                chunks.clear();
+                entityCount = 0;
+            }
+
+            /*
+             * Remplace le contenu par une copie de source (même signature, donc même
+             * disposition des chunks): une copie par colonne et par chunk
+             * remap(Entity*) donne l'entité propriétaire de chaque ligne copiée
+             * Les ticks de toutes les lignes valent tick
+             */
+            template <typename Remap>
+            void copyFrom(const Archetype &source, Remap &&remap, std::uint32_t tick)
+            {
+                clear();
+                for (std::size_t chunk = 0; chunk < source.chunks.size(); ++chunk)
+                {
+                    Chunk copy;
+                    copy.data = allocator.allocate(chunkBytes);
+                    copy.count = source.chunks[chunk].count;
+                    chunks.push_back(copy);
+
+                    Entity **owners = getEntities(chunk);
+                    Entity **sourceEntities = source.getEntities(chunk);
+                    for (std::size_t row = 0; row < copy.count; ++row)
+                    {
+                        owners[row] = remap(sourceEntities[row]);
+                    }
+
+                    for (std::size_t c = 0; c < columns.size(); ++c)
+                    {
+                        columns[c].info.copyRange(getSlot(c, chunk, 0), source.getSlot(c, chunk, 0), copy.count, owners);
+                        std::fill_n(&getTick(c, chunk, 0), copy.count, tick);
+                    }
+                }
+                entityCount = source.entityCount;
+            }
+
+            void *getSlot(std::size_t column, std::size_t chunk, std::size_t row) const
+            {
+                const Column &col = columns[column];
+                return chunks[chunk].data + col.offset + row * col.info.size;
+            }
+
+            // Tick de dernière modification d'un composant
+            std::uint32_t &getTick(std::size_t column, std::size_t chunk, std::size_t row) const
+            {
+                return reinterpret_cast<std::uint32_t *>(chunks[chunk].data + columns[column].tickOffset)[row];
+            }
+
+            Entity **getEntities(std::size_t chunk) const
+            {
+                return reinterpret_cast<Entity **>(chunks[chunk].data);
+            }
+
+            // Tableau contigu des composants T d'un chunk (T peut être const)
+            template <typename T>
+            T *getColumn(std::size_t chunk) const
+            {
+                return static_cast<T *>(getSlot(columnIndex[getComponentTypeID<T>()], chunk, 0));
+            }
+
+            // Signale modifiées toutes les lignes de la colonne de T dans un chunk
+            template <typename T>
+            void stampColumn(std::size_t chunk, std::uint32_t tick) const
+            {
+                std::size_t column = columnIndex[getComponentTypeID<T>()];
+                std::fill_n(&getTick(column, chunk, 0), chunks[chunk].count, tick);
+            }
+
+            /*
+             * Réserve une ligne pour l'entité (les composants ne sont PAS construits)
+             * Retourne {chunk, ligne}
+             */
+            std::pair<std::size_t, std::size_t> allocateRow(Entity *entity)
+            {
+                if (chunks.empty() || chunks.back().count == chunkCapacity)
+                {
+                    Chunk chunk;
+                    chunk.data = allocator.allocate(chunkBytes);
+                    chunks.push_back(chunk);
+                }
+
+                std::size_t chunk = chunks.size() - 1;
+                std::size_t row = chunks.back().count++;
+                getEntities(chunk)[row] = entity;
+                ++entityCount;
+                return {chunk, row};
+            }
+
+            /*
+             * Détruit les composants d'une ligne et comble le trou avec la dernière ligne
+             * Retourne l'entité qui a été déplacée (nullptr si aucune)
+             */
+            Entity *removeRow(std::size_t chunk, std::size_t row)
+            {
+                std::size_t lastChunk = chunks.size() - 1;
+                std::size_t lastRow = chunks[lastChunk].count - 1;
+                bool isLast = (chunk == lastChunk && row == lastRow);
+
+                for (std::size_t c = 0; c < columns.size(); ++c)
+                {
+                    void *slot = getSlot(c, chunk, row);
+                    columns[c].info.destroy(slot);
+
+                    if (!isLast)
+                    {
+                        void *last = getSlot(c, lastChunk, lastRow);
+                        columns[c].info.moveConstruct(slot, last);
+                        columns[c].info.destroy(last);
+                        getTick(c, chunk, row) = getTick(c, lastChunk, lastRow);
+                    }
+                }
+
+                Entity *moved = nullptr;
+                if (!isLast)
+                {
+                    moved = getEntities(lastChunk)[lastRow];
+                    getEntities(chunk)[row] = moved;
+                }
+
+                --entityCount;
+                if (--chunks[lastChunk].count == 0)
+                {
+                    allocator.deallocate(chunks[lastChunk].data, chunkBytes);
+                    chunks.pop_back();
+                }
+                return moved;
+            }
+
+        private:
+            // Place les colonnes les unes après les autres, retourne la taille totale
+            std::size_t computeLayout(std::size_t capacity)
+            {
+                std::size_t offset = capacity * sizeof(Entity *);
+                for (auto &column : columns)
+                {
+                    offset = (offset + column.info.alignment - 1) / column.info.alignment * column.info.alignment;
+                    column.offset = offset;
+                    offset += capacity * column.info.size;
+                }
+
+                offset = (offset + alignof(std::uint32_t) - 1) / alignof(std::uint32_t) * alignof(std::uint32_t);
+                for (auto &column : columns)
+                {
+                    column.tickOffset = offset;
+                    offset += capacity * sizeof(std::uint32_t);
+                }
+                return offset;
+            }
+        };
+    }
+
+    // ========================================================================
+    // ENTITY CLASS
+    // ========================================================================
+
+    /*
+     * Une entit� est simplement un conteneur de composants avec un ID unique
+     * Elle ne contient pas de logique, juste des donn�es (composants)
+     */
+    class Entity
+    {
+    private:
+        Manager *manager = nullptr;
+        EntityID id = 0;
+        EntityHandle handle;
+        bool active = true;
+        bool membershipDirty = false; // Signature modifiée depuis la dernière synchro avec les systèmes
+        bool membershipFullCheck = false; // Création/destruction: tous les systèmes sont re-testés
+        ComponentBitSet changedComponents; // Sinon seuls les systèmes concernés par ces types
+        LayerBitSet layers;
+        TagID tag = NO_TAG;
+        std::uint32_t tagIndex = 0; // Position dans l'index des tags du Manager
+
+        // Emplacement des composants dans le stockage par archetypes
+        Internal::Archetype *archetype = nullptr;
+        std::uint32_t chunkIndex = 0;
+        std::uint32_t chunkRow = 0;
+
+        std::uint32_t entityIndex = 0; // Position dans Manager::entities
+
+        std::uint32_t currentChangeTick() const; // Manager::getChangeTick (défini après Manager)
+
+        friend class Manager;
+        friend class System;
+
+    public:
+        Entity(Manager *mgr, EntityID entityID, EntityHandle entityHandle)
+            : manager(mgr), id(entityID), handle(entityHandle) {}
+
+        // ====================================================================
+        // LIFECYCLE
+        // ====================================================================
+
+        void update()
         {
-            if (layer < MAX_LAYERS)
+            for (std::size_t c = 0; c < archetype->columns.size(); ++c)
             {
-                layers.set(layer);
+                archetype->columns[c].info.asComponent(archetype->getSlot(c, chunkIndex, chunkRow))->update();
             }
         }
 
-        void removeLayer(Layer layer)
+        void draw()
         {
-            if (layer < MAX_LAYERS)
+            for (std::size_t c = 0; c < archetype->columns.size(); ++c)
             {
-                layers.reset(layer);
+                archetype->columns[c].info.asComponent(archetype->getSlot(c, chunkIndex, chunkRow))->draw();
             }
         }
 
+        bool isActive() const { return active; }
+        void destroy(); // Les systèmes sont prévenus au prochain refresh()
+        EntityID getID() const { return id; }
+        EntityHandle getHandle() const { return handle; }
+
+        // ====================================================================
+        // TAG SYSTEM
+        // ====================================================================
+
+        /*
+         * Un tag identifie une entité ou un groupe d'entités (Player, Enemy, Boss...)
+         * Plusieurs entités peuvent partager un tag (voir Manager::getEntitiesByTag)
+         * Préférez les versions TagID: comparaison d'entiers, sans recherche de chaîne
+         * Sans effet sur une entité détruite (isActive() == false)
+         */
+        void setTag(TagID t);
+        void setTag(const std::string &t) { setTag(ECS::getTagID(t)); }
+        TagID getTagID() const { return tag; }
+        const std::string &getTag() const { return getTagName(tag); }
+        bool hasTag(TagID t) const { return tag == t; }
+        bool hasTag(const std::string &t) const { return getTag() == t; } // Sans interner t
+
+        // ====================================================================
+        // LAYER SYSTEM
+        // ====================================================================
+
+        /*
+         * Les layers permettent de grouper les entit�s (une entit� peut avoir plusieurs layers)
+         * Exemple: une entit� peut �tre � la fois Enemy + Renderable + Collidable
+         */
+        void addLayer(Layer layer); // Sans effet sur une entité détruite
+        void removeLayer(Layer layer);
+
         bool hasLayer(Layer layer) const
         {
             return layer < MAX_LAYERS && layers.test(layer);
@@ -254,9 +1322,16 @@ namespace ECS
         template <typename T>
         bool hasComponent() const
         {
-            return componentBitSet[getComponentTypeID<T>()];
+            return archetype->signature[getComponentTypeID<T>()];
+        }
+
+        bool hasComponent(ComponentID typeID) const
+        {
+            return typeID < MAX_COMPONENTS && archetype->signature[typeID];
         }
 
+        const ComponentBitSet &getComponentBitSet() const { return archetype->signature; }
+
         /*
          * Ajoute un composant � l'entit�
          *
@@ -268,79 +1343,121 @@ namespace ECS
          *   entity.addComponent<VelocityComponent>();
          */
         template <typename T, typename... TArgs>
-        T &addComponent(TArgs &&...args)
-        {
-            // V�rification: pas plus de MAX_COMPONENTS types diff�rents
-            ComponentID typeID = getComponentTypeID<T>();
-            if (typeID >= MAX_COMPONENTS)
-            {
-                throw std::runtime_error("MAX_COMPONENTS exceeded!");
-            }
-
-            // Cr�ation du composant avec perfect forwarding des arguments
-            T *component = new T(std::forward<TArgs>(args)...);
-            component->entity = this;
-
-            // Stockage dans un unique_ptr pour gestion automatique de la m�moire
-            std::unique_ptr<Component> uPtr{component};
-            components.emplace_back(std::move(uPtr));
-
-            // Enregistrement dans l'array d'acc�s rapide et le bitset
-            componentArray[typeID] = component;
-            componentBitSet[typeID] = true;
-
-            // Appel du hook d'initialisation
-            component->init();
-
-            return *component;
-        }
+        T &addComponent(TArgs &&...args);
 
         /*
          * R�cup�re un composant par son type
-         * ATTENTION: crash si le composant n'existe pas! V�rifiez avec hasComponent() avant
+         * ATTENTION: std::runtime_error si le composant n'existe pas! V�rifiez avec hasComponent() avant
          *
          * Exemple:
          *   if (entity.hasComponent<TransformComponent>()) {
          *       auto& transform = entity.getComponent<TransformComponent>();
          *   }
+         *
+         * Règle de change detection: accès non const = écriture. getComponent<T>()
+         * signale toujours T modifié (hasChanged, observers Changed), même si
+         * l'appelant ne fait que lire. Pour lire, demander le type const: le tick
+         * n'est pas touché (obligatoire pour un type déclaré Access::Read)
+         *   const auto& sprite = entity.getComponent<const SpriteComponent>();
          */
         template <typename T>
         T &getComponent() const
         {
-            auto ptr = componentArray[getComponentTypeID<T>()];
-            return *static_cast<T *>(ptr);
+            int column = archetype->columnIndex[getComponentTypeID<T>()];
+            if (column < 0)
+            {
+                throw std::runtime_error("getComponent: composant absent (voir hasComponent)");
+            }
+            if constexpr (!std::is_const<T>::value)
+            {
+                archetype->getTick(column, chunkIndex, chunkRow) = currentChangeTick();
+            }
+            return *static_cast<T *>(archetype->getSlot(column, chunkIndex, chunkRow));
         }
 
         /*
-         * Retire un composant de l'entit�
+         * Identique à getComponent<T>() (qui signale déjà la modification)
+         * Conservé pour le code existant
          */
         template <typename T>
-        void removeComponent()
+        T &patchComponent()
         {
-            ComponentID typeID = getComponentTypeID<T>();
-            if (componentBitSet[typeID])
-            {
-                componentBitSet[typeID] = false;
-                componentArray[typeID] = nullptr;
+            return getComponent<T>();
+        }
 
-                // Suppression du composant du vecteur
-                components.erase(
-                    std::remove_if(components.begin(), components.end(),
-                                   [typeID](const std::unique_ptr<Component> &c)
-                                   {
-                                       return dynamic_cast<T *>(c.get()) != nullptr;
-                                   }),
-                    components.end());
-            }
+        // Signale que le composant T a été modifié (thread-safe entre entités différentes)
+        // Sans effet si l'entité n'a pas T
+        template <typename T>
+        void markChanged();
+
+        // Tick du Manager lors de la dernière modification signalée (ou de l'ajout) de T
+        // 0 si l'entité n'a pas T
+        template <typename T>
+        std::uint32_t getChangeTick() const
+        {
+            int column = archetype->columnIndex[getComponentTypeID<T>()];
+            return column < 0 ? 0 : archetype->getTick(column, chunkIndex, chunkRow);
         }
-    };
 
-    // ========================================================================
-    // SYSTEM BASE CLASS
-    // ========================================================================
+        // Vrai si T a été ajouté ou modifié pendant ou après le tick donné
+        template <typename T>
+        bool changedSince(std::uint32_t tick) const
+        {
+            return getChangeTick<T>() >= tick;
+        }
 
-    /*
-     * Classe de base pour tous les syst�mes
+        /*
+         * Retire un composant de l'entit�
+         */
+        template <typename T>
+        void removeComponent();
+
+        /*
+         * Retire un composant à partir de son ID (ex: effets de statut gérés par ID)
+         * Temps constant: la transition d'archetype est mémorisée après la première fois
+         */
+        void removeComponent(ComponentID typeID);
+    };
+
+    // ========================================================================
+    // SYSTEM BASE CLASS
+    // ========================================================================
+
+    namespace Internal
+    {
+        inline std::size_t nextSystemTypeID()
+        {
+            static std::atomic<std::size_t> next{0};
+            return next++;
+        }
+    }
+
+    /*
+     * Clé du cache de getSystems<T> (simple static par instanciation, sans le registre
+     * type_index de getComponentTypeID): deux modules (DLL) peuvent obtenir deux clés
+     * pour le même T, ce qui ne fait que dupliquer une entrée de cache
+     */
+    template <typename T>
+    inline std::size_t getSystemTypeID()
+    {
+        static const std::size_t id = Internal::nextSystemTypeID();
+        return id;
+    }
+
+    /*
+     * Accès d'un système à un type de composant pendant update()
+     * Deux systèmes peuvent tourner en parallèle s'ils n'écrivent pas
+     * un composant que l'autre lit ou écrit
+     * Read: n'y accéder qu'en const (getComponent<const T>, view<const T>)
+     */
+    enum class Access
+    {
+        Read,
+        Write
+    };
+
+    /*
+     * Classe de base pour tous les syst�mes
      * Un syst�me contient la logique qui op�re sur les entit�s ayant certains composants
      *
      * Exemple d'utilisation:
@@ -365,8 +1482,59 @@ namespace ECS
     protected:
         Manager *manager = nullptr;
         ComponentBitSet componentSignature; // Quels composants ce syst�me requiert
+        ComponentBitSet excludeSignature;   // Composants qui écartent une entité du système
         std::vector<Entity *> entities;     // Entit�s qui matchent la signature
         int priority = 0;                   // Ordre d'ex�cution (plus petit = ex�cut� en premier)
+        ComponentBitSet readAccess;         // Composants lus pendant update()
+        ComponentBitSet writeAccess;        // Composants modifiés pendant update()
+        bool exclusive = false;             // Ne tourne jamais en parallèle d'un autre système
+        std::size_t parallelThreshold = DEFAULT_PARALLEL_THRESHOLD;
+        std::uint32_t lastRunTick = 0;      // Tick de la frame du dernier update() (0: jamais)
+        float updateInterval = 0.0f;        // Durée d'un pas fixe en secondes (0: une fois par frame)
+        std::vector<bool (*)(const System &)> runsAfter; // Systèmes à laisser passer avant (voir runAfter)
+
+    private:
+        std::size_t fixedRateIndex = 0; // Cadence partagée dans le Manager (si updateInterval > 0)
+
+        // Profiler: noms des mesures (fixés par addSystem) et durées glissantes
+        const char *updateProfileName = "System::update";
+        const char *renderProfileName = "System::render";
+        RollingTimes updateTimes;
+        RollingTimes renderTimes;
+
+        Internal::MemoryHistory memoryHistory; // Liste d'entités (voir Manager::sampleMemory)
+
+        // Position de chaque entité dans `entities`, indexée par slot (NOT_MEMBER si absente)
+        static constexpr std::uint32_t NOT_MEMBER = 0xFFFFFFFFu;
+        std::vector<std::uint32_t> entityIndex;
+
+        bool contains(const Entity &entity) const
+        {
+            std::uint32_t slot = entity.handle.index;
+            return slot < entityIndex.size() && entityIndex[slot] != NOT_MEMBER;
+        }
+
+        void addEntity(Entity *entity)
+        {
+            std::uint32_t slot = entity->handle.index;
+            if (slot >= entityIndex.size())
+            {
+                entityIndex.resize(slot + 1, NOT_MEMBER);
+            }
+            entityIndex[slot] = static_cast<std::uint32_t>(entities.size());
+            entities.push_back(entity);
+        }
+
+        // Swap avec la dernière entité puis pop: O(1), l'ordre n'est pas conservé
+        void removeEntity(Entity *entity)
+        {
+            std::uint32_t position = entityIndex[entity->handle.index];
+            Entity *last = entities.back();
+            entities[position] = last;
+            entityIndex[last->handle.index] = position;
+            entities.pop_back();
+            entityIndex[entity->handle.index] = NOT_MEMBER;
+        }
 
     public:
         virtual ~System() = default;
@@ -376,10 +1544,96 @@ namespace ECS
          * � appeler dans le constructeur de votre syst�me
          */
         template <typename T>
-        void requireComponent()
+        void requireComponent(Access access = Access::Write)
         {
             ComponentID typeID = getComponentTypeID<T>();
             componentSignature.set(typeID);
+            accessComponent<T>(access);
+        }
+
+        /*
+         * Les entités qui possèdent ce composant sont ignorées par le système
+         * Exemple: requireComponent<CollisionComponent>(); excludeComponent<StaticComponent>();
+         */
+        template <typename T>
+        void excludeComponent()
+        {
+            excludeSignature.set(getComponentTypeID<T>());
+        }
+
+        /*
+         * Composant utilisé s'il est présent, sans être requis (n'influence pas la signature)
+         * Tester hasComponent<T>() avant getComponent<T>() sur ces composants
+         */
+        template <typename T>
+        void optionalComponent(Access access = Access::Write)
+        {
+            accessComponent<T>(access);
+        }
+
+        /*
+         * Déclare un accès à un composant sans l'exiger dans la signature
+         * (ex: CameraSystem lit le TransformComponent de sa cible)
+         * Nécessaire pour que le scheduler parallèle ne lance pas en même temps
+         * deux systèmes qui se marchent dessus
+         */
+        template <typename T>
+        void accessComponent(Access access)
+        {
+            ComponentID typeID = getComponentTypeID<T>();
+            if (access == Access::Write)
+            {
+                writeAccess.set(typeID);
+            }
+            else
+            {
+                readAccess.set(typeID);
+            }
+        }
+
+        /*
+         * Un système exclusif a des effets hors des composants (callbacks, audio,
+         * chargement de map...) et s'exécute seul, dans l'ordre des priorités
+         */
+        void setExclusive(bool state) { exclusive = state; }
+        bool isExclusive() const { return exclusive; }
+
+        /*
+         * Ce système s'exécute après les systèmes de type T (ou dérivés), quelles
+         * que soient les priorités, y compris avec le scheduler parallèle
+         * À appeler dans le constructeur de votre système
+         * Exemple: runAfter<MovementSystem>(); // Lit les positions du pas en cours
+         */
+        template <typename T>
+        void runAfter()
+        {
+            runsAfter.push_back([](const System &other)
+                                { return dynamic_cast<const T *>(&other) != nullptr; });
+        }
+
+        bool mustRunAfter(const System &other) const
+        {
+            for (auto isBefore : runsAfter)
+            {
+                if (isBefore(other))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /*
+         * Vrai si les deux systèmes ne peuvent pas tourner en même temps
+         */
+        bool conflictsWith(const System &other) const
+        {
+            if (exclusive || other.exclusive)
+            {
+                return true;
+            }
+            return writeAccess.intersects(other.readAccess | other.writeAccess) ||
+                   other.writeAccess.intersects(readAccess);
         }
 
         /*
@@ -387,14 +1641,99 @@ namespace ECS
          */
         bool matchesSignature(const Entity &entity) const
         {
-            return (componentSignature & entity.componentBitSet) == componentSignature;
+            const ComponentBitSet &signature = entity.archetype->signature;
+            return signature.containsAll(componentSignature) && !signature.intersects(excludeSignature);
         }
 
         const std::vector<Entity *> &getEntities() const { return entities; }
 
-        void setPriority(int p) { priority = p; }
+        /*
+         * Comme une boucle sur getEntities(), mais découpée en lots de grainSize
+         * entités exécutés sur le pool de threads du Manager (voir setThreadCount)
+         * Séquentiel sans pool ou sous le seuil (setParallelThreshold)
+         * func ne doit modifier que l'entité reçue
+         *
+         * Exemple:
+         *   parallelForEach([&](ECS::Entity *entity) { ... });
+         */
+        template <typename Func>
+        void parallelForEach(Func &&func, std::size_t grainSize = DEFAULT_GRAIN_SIZE);
+
+        void setParallelThreshold(std::size_t count) { parallelThreshold = count; }
+
+        void setPriority(int p); // Replace le système dans l'ordre d'exécution (au prochain update)
         int getPriority() const { return priority; }
 
+        // ====================================================================
+        // FIXED TIMESTEP
+        // ====================================================================
+
+        /*
+         * Fait tourner update() à hz pas fixes par seconde (0: une fois par frame)
+         * update() reçoit alors toujours 1/hz, et est appelé 0, 1 ou plusieurs fois
+         * par frame selon le temps accumulé. Les systèmes de même cadence partagent
+         * le même accumulateur et s'alternent pas par pas, dans l'ordre des priorités
+         *
+         * Exemple:
+         *   setUpdateRate(60.0f); // physique
+         *   setUpdateRate(10.0f); // IA
+         */
+        void setUpdateRate(float hz) { updateInterval = hz > 0.0f ? 1.0f / hz : 0.0f; }
+        float getUpdateRate() const { return updateInterval > 0.0f ? 1.0f / updateInterval : 0.0f; }
+        bool isFixedRate() const { return updateInterval > 0.0f; }
+
+        /*
+         * Fraction du pas fixe suivant déjà écoulée (entre 0 et 1), pour interpoler
+         * le rendu entre l'état précédent et l'état courant. 1 pour un système par frame
+         */
+        float getInterpolationAlpha() const;
+
+        // ====================================================================
+        // PROFILING
+        // ====================================================================
+
+        /*
+         * Durées (ms) des RollingTimes::WINDOW derniers update()/render() de ce système
+         * Un système à pas fixe compte une mesure par pas
+         * Toujours vides si compilé avec ECS_ENABLE_PROFILER=0
+         */
+        ProfileStats getUpdateStats() const { return updateTimes.getStats(); }
+        ProfileStats getRenderStats() const { return renderTimes.getStats(); }
+
+        // ====================================================================
+        // CHANGE DETECTION
+        // ====================================================================
+
+        std::uint32_t getLastRunTick() const { return lastRunTick; }
+
+        /*
+         * Vrai si le composant T de l'entité a été ajouté ou obtenu en accès modifiable
+         * (getComponent<T>, View sur T non const, markChanged) depuis le dernier
+         * update() de ce système
+         * Prudent: une modification peut être vue deux fois, jamais manquée
+         */
+        template <typename T>
+        bool hasChanged(const Entity &entity) const
+        {
+            return entity.changedSince<T>(lastRunTick);
+        }
+
+        /*
+         * Appelle func(Entity*) sur les entités du système dont T a changé
+         * Exemple: forEachChanged<TransformComponent>([](ECS::Entity *e) { ... });
+         */
+        template <typename T, typename Func>
+        void forEachChanged(Func &&func)
+        {
+            for (Entity *entity : entities)
+            {
+                if (entity->changedSince<T>(lastRunTick))
+                {
+                    func(entity);
+                }
+            }
+        }
+
         // Hooks du cycle de vie
         virtual void init() {}                          // Appel� � l'ajout du syst�me
         virtual void update(float deltaTime) {}         // Appel pour les system logique
@@ -406,123 +1745,2254 @@ namespace ECS
     };
 
     // ========================================================================
-    // MANAGER CLASS
+    // VIEWS
     // ========================================================================
 
     /*
-     * Le Manager g�re toutes les entit�s et syst�mes
-     * C'est le point d'entr�e principal de l'ECS
+     * Une View parcourt directement les colonnes des archetypes qui contiennent
+     * tous les types demandés, sans passer par Entity* -> getComponent
+     * Obtenue via manager.view<Ts...>() (les archetypes correspondants sont mis en cache)
+     *
+     * Exemple:
+     *   manager.view<TransformComponent, SpriteComponent>().each(
+     *       [](TransformComponent &transform, SpriteComponent &sprite) { ... });
+     *
+     *   // Avec l'entité en premier paramètre:
+     *   manager.view<TransformComponent>().each(
+     *       [](ECS::Entity &entity, TransformComponent &transform) { ... });
+     *
+     *   // Par chunk: tableaux contigus, idéal pour des boucles serrées
+     *   manager.view<TransformComponent>().eachChunk(
+     *       [](std::size_t count, TransformComponent *transforms) { ... });
+     *
+     * Un type non const est signalé modifié pour chaque entité parcourue (change
+     * detection, observers Changed), un chunk à la fois. Un type seulement lu
+     * se demande const, ex: view<TransformComponent, const SpriteComponent>()
+     * (obligatoire s'il est déclaré Access::Read)
+     *
+     * Créez la View au moment du parcours: elle ne voit pas les archetypes apparus après sa création
+     * Comme getEntities(), une View voit les entités détruites jusqu'au prochain refresh()
+     * Ne pas ajouter/retirer de composant pendant le parcours (l'entité changerait d'archetype)
      */
-    class Manager
+    template <typename... Ts>
+    class View
     {
     private:
-        std::vector<std::unique_ptr<Entity>> entities;
-        std::vector<std::unique_ptr<System>> systems;
-        std::unordered_map<std::string, Entity *> taggedEntities;
-        EntityID nextEntityID = 0;
+        const std::vector<Internal::Archetype *> *archetypes;
+        ThreadPool *threadPool;
+        std::uint32_t tick; // Tick du Manager à la création de la View
+
+        // Accès modifiable: les colonnes non const du chunk prennent le tick courant
+        void stampChunk(Internal::Archetype &archetype, std::size_t chunk) const
+        {
+            (stampIfMutable<Ts>(archetype, chunk), ...);
+        }
+
+        template <typename T>
+        void stampIfMutable(Internal::Archetype &archetype, std::size_t chunk) const
+        {
+            if constexpr (!std::is_const<T>::value)
+            {
+                archetype.stampColumn<T>(chunk, tick);
+            }
+        }
+
+        // Appelle func(Ts&...) ou func(Entity&, Ts&...) sur chaque ligne d'un chunk
+        template <typename Func>
+        static void eachInChunk(Func &func, std::size_t count, Entity **entities, Ts *...columns)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if constexpr (std::is_invocable_v<Func &, Entity &, Ts &...>)
+                {
+                    func(*entities[i], columns[i]...);
+                }
+                else
+                {
+                    func(columns[i]...);
+                }
+            }
+        }
+
+        // Appelle func(count, entities, colonnes...) pour chaque chunk non vide
+        template <typename Func>
+        void forEachChunk(Func &&func) const
+        {
+            for (Internal::Archetype *archetype : *archetypes)
+            {
+                for (std::size_t c = 0; c < archetype->chunks.size(); ++c)
+                {
+                    stampChunk(*archetype, c);
+                    func(archetype->chunks[c].count, archetype->getEntities(c), archetype->template getColumn<Ts>(c)...);
+                }
+            }
+        }
 
     public:
-        // ====================================================================
-        // ENTITY MANAGEMENT
-        // ====================================================================
+        View(const std::vector<Internal::Archetype *> &matchingArchetypes, ThreadPool *pool, std::uint32_t changeTick)
+            : archetypes(&matchingArchetypes), threadPool(pool), tick(changeTick) {}
 
         /*
-         * Cr�e une nouvelle entit�
-         * Retourne une r�f�rence vers l'entit� cr��e
+         * Appelle func(Ts&...) ou func(Entity&, Ts&...) pour chaque entité
          */
-        Entity &createEntity()
+        template <typename Func>
+        void each(Func &&func) const
         {
-            auto entity = std::make_unique<Entity>(this, nextEntityID++);
-            Entity *entityPtr = entity.get();
-            entities.emplace_back(std::move(entity));
-            return *entityPtr;
+            forEachChunk([&func](std::size_t count, Entity **entities, Ts *...columns)
+                         { eachInChunk(func, count, entities, columns...); });
         }
 
         /*
-         * Cr�e une entit� avec un tag
+         * Comme each(), mais les chunks sont regroupés en lots d'au moins grainSize
+         * entités répartis sur le pool de threads du Manager
+         * Séquentiel sans pool ou sous threshold entités
+         * func ne doit modifier que les composants qu'elle reçoit
          */
-        Entity &createEntity(const std::string &tag)
+        template <typename Func>
+        void parallelEach(Func &&func, std::size_t grainSize = DEFAULT_GRAIN_SIZE,
+                          std::size_t threshold = DEFAULT_PARALLEL_THRESHOLD) const
         {
-            Entity &entity = createEntity();
-            entity.setTag(tag);
-            taggedEntities[tag] = &entity;
-            return entity;
+            if (!threadPool || size() < threshold)
+            {
+                each(func);
+                return;
+            }
+
+            // Un chunk est déjà un bloc contigu: les lots ne coupent jamais un chunk
+            struct ChunkRef
+            {
+                Internal::Archetype *archetype;
+                std::size_t chunk;
+            };
+            std::vector<ChunkRef> chunkRefs;
+            std::vector<std::size_t> batchStarts;
+            std::size_t batchRows = grainSize;
+
+            for (Internal::Archetype *archetype : *archetypes)
+            {
+                for (std::size_t c = 0; c < archetype->chunks.size(); ++c)
+                {
+                    if (batchRows >= grainSize)
+                    {
+                        batchStarts.push_back(chunkRefs.size());
+                        batchRows = 0;
+                    }
+                    chunkRefs.push_back({archetype, c});
+                    batchRows += archetype->chunks[c].count;
+                }
+            }
+            batchStarts.push_back(chunkRefs.size());
+
+            threadPool->parallelFor(batchStarts.size() - 1, 1, [&](std::size_t begin, std::size_t end)
+                                    {
+                                        for (std::size_t b = begin; b < end; ++b)
+                                        {
+                                            for (std::size_t r = batchStarts[b]; r < batchStarts[b + 1]; ++r)
+                                            {
+                                                Internal::Archetype *archetype = chunkRefs[r].archetype;
+                                                std::size_t c = chunkRefs[r].chunk;
+                                                stampChunk(*archetype, c);
+                                                eachInChunk(func, archetype->chunks[c].count, archetype->getEntities(c),
+                                                            archetype->template getColumn<Ts>(c)...);
+                                            }
+                                        }
+                                    });
         }
 
         /*
-         * R�cup�re toutes les entit�s
+         * Appelle func(count, Ts*...) pour chaque chunk
          */
-        const std::vector<std::unique_ptr<Entity>> &getEntities() const
+        template <typename Func>
+        void eachChunk(Func &&func) const
         {
-            return entities;
+            forEachChunk([&func](std::size_t count, Entity **, Ts *...columns)
+                         { func(count, columns...); });
         }
 
-        /*
-         * R�cup�re une entit� par son tag
-         * Retourne nullptr si aucune entit� n'a ce tag
-         */
-        Entity *getEntityByTag(const std::string &tag)
+        std::size_t size() const
         {
-            auto it = taggedEntities.find(tag);
-            return (it != taggedEntities.end()) ? it->second : nullptr;
+            std::size_t total = 0;
+            for (Internal::Archetype *archetype : *archetypes)
+            {
+                total += archetype->entityCount;
+            }
+            return total;
         }
 
+        bool empty() const { return size() == 0; }
+    };
+
+    // ========================================================================
+    // COMMAND BUFFER
+    // ========================================================================
+
+    /*
+     * Enregistre des changements de structure (création/destruction d'entités,
+     * ajout/retrait de composants) pour les appliquer plus tard, en un seul passage
+     *
+     * Pendant un update(), modifier directement la structure est dangereux:
+     * l'entité change d'archetype sous les pieds de la View ou de getEntities()
+     * qu'on est en train de parcourir, et ce n'est pas thread-safe.
+     * Le CommandBuffer peut être rempli depuis n'importe quel thread.
+     *
+     * Le buffer du Manager (manager.getCommandBuffer()) est rejoué au début de refresh()
+     *
+     * Exemple:
+     *   auto &commands = manager->getCommandBuffer();
+     *   auto spell = commands.createEntity();
+     *   commands.addComponent<TransformComponent>(spell, x, y);
+     *   commands.destroy(enemy->getHandle());
+     */
+    class CommandBuffer
+    {
+    public:
         /*
-         * R�cup�re toutes les entit�s d'un layer sp�cifique
+         * Cible d'une commande: une entité existante (handle) ou une entité
+         * créée plus tôt dans ce même buffer (pas encore réelle)
+         * Une ref pending n'est valable que dans son buffer, jusqu'au prochain playback()
          */
-        std::vector<Entity *> getEntitiesByLayer(Layer layer)
+        struct EntityRef
+        {
+            static constexpr std::uint32_t NOT_PENDING = 0xFFFFFFFFu;
+
+            EntityHandle handle;
+            std::uint32_t pending = NOT_PENDING;
+            const CommandBuffer *owner = nullptr; // Buffer qui a créé la ref pending
+            std::uint32_t epoch = 0;              // Nombre de playback() du buffer à la création
+
+            EntityRef() = default;
+            EntityRef(EntityHandle entityHandle) : handle(entityHandle) {}
+        };
+
+    private:
+        struct Command
+        {
+            EntityRef target;
+            std::function<void(Entity &)> apply; // Vide: création de l'entité target.pending
+        };
+
+        std::mutex mutex;
+        std::vector<Command> commands;
+        std::uint32_t pendingCount = 0;
+        std::uint32_t epoch = 0;
+
+        void push(EntityRef target, std::function<void(Entity &)> apply)
         {
-            std::vector<Entity *> result;
-            for (auto &entity : entities)
+            std::lock_guard<std::mutex> lock(mutex);
+            // Ref pending d'un autre buffer ou d'avant le dernier playback(): son index
+            // ne correspond à aucune entité créée par ce buffer
+            if (target.pending != EntityRef::NOT_PENDING &&
+                (target.owner != this || target.epoch != epoch || target.pending >= pendingCount))
             {
-                if (entity->isActive() && entity->hasLayer(layer))
-                {
-                    result.push_back(entity.get());
-                }
+                std::cerr << "[CommandBuffer] ERROR: stale or foreign EntityRef, command ignored\n";
+                return;
             }
-            return result;
+            commands.push_back({target, std::move(apply)});
+        }
+
+    public:
+        EntityRef createEntity()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            EntityRef ref;
+            ref.pending = pendingCount++;
+            ref.owner = this;
+            ref.epoch = epoch;
+            commands.push_back({ref, nullptr});
+            return ref;
+        }
+
+        void destroy(EntityRef target)
+        {
+            push(target, [](Entity &entity)
+                 { entity.destroy(); });
+        }
+
+        // Les arguments sont copiés/déplacés dans le buffer jusqu'à la lecture
+        template <typename T, typename... TArgs>
+        void addComponent(EntityRef target, TArgs &&...args)
+        {
+            push(target, [arguments = std::make_tuple(std::forward<TArgs>(args)...)](Entity &entity) mutable
+                 { std::apply([&entity](auto &&...values)
+                              { entity.addComponent<T>(std::move(values)...); },
+                              std::move(arguments)); });
+        }
+
+        template <typename T>
+        void removeComponent(EntityRef target)
+        {
+            push(target, [](Entity &entity)
+                 { entity.removeComponent<T>(); });
+        }
+
+        bool empty()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return commands.empty();
         }
 
         /*
-         * Supprime les entit�s marqu�es comme inactives
-         * � appeler � la fin de chaque frame
+         * Applique toutes les commandes dans l'ordre d'enregistrement puis vide le buffer
+         * Les commandes visant une entité déjà détruite sont ignorées
          */
-        void refresh()
+        void playback(Manager &manager);
+    };
+
+    // ========================================================================
+    // OBSERVERS
+    // ========================================================================
+
+    /*
+     * Un observer s'abonne à un type de composant et reçoit, une fois par
+     * refresh(), la liste de toutes les entités concernées par un événement
+     * (au lieu d'un appel virtuel par événement comme onEntityAdded)
+     *
+     *   Added:   composant ajouté (remplacer un composant existant ne compte pas)
+     *   Removed: composant retiré, ou entité détruite
+     *   Changed: ajouté ou obtenu en accès modifiable (getComponent<T>, View non const, markChanged)
+     *
+     * Les handles d'un batch Added/Changed peuvent ne plus résoudre si l'entité
+     * a été détruite entre-temps: vérifier avec manager.getEntity(handle)
+     *
+     * Exemple:
+     *   manager.observe<CollisionComponent>(ECS::ComponentEvent::Added,
+     *       [&](const std::vector<ECS::EntityHandle> &added) { grid.insert(added); });
+     */
+    enum class ComponentEvent
+    {
+        Added,
+        Removed,
+        Changed
+    };
+
+    using ObserverID = std::size_t;
+    using ObserverCallback = std::function<void(const std::vector<EntityHandle> &)>;
+
+    // ========================================================================
+    // RESOURCES
+    // ========================================================================
+
+    /*
+     * Ressources: un objet unique par type, partagé par tout le monde
+     * (tilemap courante, caméra, réglages...), sans entité à chercher
+     *
+     * Exemple:
+     *   manager.setResource<CameraComponent>(800.0f, 600.0f);
+     *   if (auto *camera = manager.resource<CameraComponent>()) { ... }
+     */
+    namespace Internal
+    {
+        inline std::size_t nextResourceTypeID()
+        {
+            static std::atomic<std::size_t> next{0};
+            return next++;
+        }
+
+        struct ResourceBase
+        {
+            virtual ~ResourceBase() = default;
+
+            // Pour Manager::sampleMemory
+            virtual const char *typeName() const = 0;
+            virtual std::size_t memoryUsage() const = 0;
+        };
+
+        template <typename T>
+        struct ResourceHolder : ResourceBase
+        {
+            T value;
+
+            template <typename... TArgs>
+            explicit ResourceHolder(TArgs &&...args) : value(std::forward<TArgs>(args)...) {}
+
+            const char *typeName() const override { return typeid(T).name(); }
+            std::size_t memoryUsage() const override { return sizeof(T) + heapBytes(value); }
+        };
+    }
+
+    template <typename T>
+    inline std::size_t getResourceTypeID()
+    {
+        static const std::size_t id = Internal::nextResourceTypeID();
+        return id;
+    }
+
+    // ========================================================================
+    // MANAGER CLASS
+    // ========================================================================
+
+    /*
+     * Le Manager g�re toutes les entit�s et syst�mes
+     * C'est le point d'entr�e principal de l'ECS
+     */
+    class Manager
+    {
+    private:
+        std::vector<Entity *> entities; // Entités vivantes (ordre non garanti: retrait par swap-and-pop)
+        std::vector<std::unique_ptr<System>> systems;
+        std::vector<std::vector<Entity *>> taggedEntities; // TagID -> entités portant ce tag
+        EntityID nextEntityID = 0;
+
+        // Table des slots: handle.index -> entité + génération courante
+        // Le slot garde son objet Entity après destruction pour le réutiliser
+        struct EntitySlot
+        {
+            std::unique_ptr<Entity> storage;
+            Entity *entity = nullptr; // nullptr si le slot est libre
+            std::uint32_t generation = 0;
+        };
+        std::vector<EntitySlot> slots;
+        std::vector<std::uint32_t> freeSlots;
+
+        // Liste dense des entités de chaque layer, maintenue par addLayer/removeLayer
+        struct LayerList
+        {
+            std::vector<Entity *> entities;
+            std::vector<std::uint32_t> positions; // Slot d'entité -> position dans entities
+        };
+        std::array<LayerList, MAX_LAYERS> layerLists;
+
+        // Entités détruites depuis le dernier refresh()
+        std::vector<Entity *> pendingDestroy;
+
+        // Scheduler parallèle (nullptr: exécution séquentielle)
+        std::unique_ptr<ThreadPool> threadPool;
+        std::vector<std::vector<std::size_t>> systemDependents; // i -> systèmes qui attendent i
+        std::vector<std::size_t> systemDependencyCount;         // Nombre de systèmes à attendre
+        bool scheduleDirty = true;
+
+        // Une entrée par cadence fixe (voir System::setUpdateRate)
+        struct FixedRate
+        {
+            float interval;           // Durée d'un pas en secondes
+            float accumulator = 0.0f; // Temps écoulé pas encore consommé par un pas
+            std::size_t steps = 0;    // Pas à exécuter pendant la frame courante
+        };
+        std::vector<FixedRate> fixedRates;
+        std::size_t maxFixedSteps = DEFAULT_MAX_FIXED_STEPS;
+        std::vector<char> systemActive; // Systèmes à lancer pendant la passe courante
+
+        // Tick de change detection: incrémenté au début de chaque update() et à la fin de refresh()
+        std::uint32_t changeTick = 1;
+
+        // Changements différés, rejoués au début de refresh()
+        CommandBuffer commandBuffer;
+
+        // Ressources indexées par getResourceTypeID<T>() (nullptr si absente)
+        std::vector<std::unique_ptr<Internal::ResourceBase>> resources;
+
+        // Observers par type de composant, déclenchés à la fin de refresh()
+        struct Observer
+        {
+            ObserverID id;
+            ComponentEvent event;
+            ObserverCallback callback; // nullptr après unobserve (retiré au prochain flush)
+        };
+        struct ObservedType
+        {
+            std::vector<Observer> observers;
+            std::vector<EntityHandle> added;
+            std::vector<EntityHandle> removed;
+        };
+        std::unordered_map<ComponentID, ObservedType> observedTypes;
+        std::vector<ComponentID> observedTypeList; // Ordre de flush (stable pendant les callbacks)
+        ComponentBitSet observedAdded;             // Test rapide avant d'enregistrer un événement
+        ComponentBitSet observedRemoved;
+        ComponentBitSet observedChanged;
+        ObserverID nextObserverID = 0;
+        std::uint32_t observerTick = 0; // Ticks >= observerTick: pas encore signalés comme Changed
+
+        // Entités à re-tester contre les signatures des systèmes
+        std::vector<Entity *> dirtyEntities;
+
+        // Comptabilité mémoire (voir sampleMemory)
+        MemoryReport memoryReport;
+        std::array<Internal::MemoryHistory, MAX_COMPONENTS> componentMemory{};
+        std::vector<Internal::MemoryHistory> resourceMemory; // Indexé comme resources
+        std::vector<std::string> resourceNames;              // Gardés après removeResource
+        Internal::MemoryHistory entityMemory;
+        Internal::MemoryHistory chunkMemory;
+        Internal::MemoryHistory totalMemory;
+
+        // Snapshots (voir saveSnapshot)
+        static constexpr std::uint32_t SNAPSHOT_MAGIC = 0x53534345; // "ECSS"
+        static constexpr std::uint32_t SNAPSHOT_VERSION = 2; // 2: champs Raw listés, sans padding
+        struct SnapshotEntity
+        {
+            std::uint32_t slot;
+            std::uint32_t tag; // Index dans la table des tags du snapshot (0: aucun)
+            std::uint32_t layers;
+            std::uint32_t padding = 0;
+            std::uint64_t id;
+        };
+
+        // Type de composant -> systèmes qui l'ont dans leur signature (requis ou exclu)
+        std::array<std::vector<System *>, MAX_COMPONENTS> componentSystems;
+
+        // Mémoire des chunks de tous les archetypes (doit survivre aux archetypes)
+        Internal::ChunkAllocator chunkAllocator;
+
+        // Un archetype par signature rencontrée (détruits avant les entités)
+        std::unordered_map<ComponentBitSet, std::unique_ptr<Internal::Archetype>, ComponentBitSet::Hash> archetypes;
+        std::vector<Internal::Archetype *> archetypeList;
+
+        /*
+         * Cache de getSystem<T>/getSystems<T>, indexé par getSystemTypeID<T>()
+         * Une entrée est reconstruite (dynamic_cast) quand systemsVersion a changé
+         * addSystem<T> crée l'entrée de T. Pendant les update() parallèles, les entrées
+         * existantes sont déjà à jour (refreshSystemCaches) et lues sous verrou partagé;
+         * une entrée manquante (ex: getSystem<Base>) est créée sous verrou exclusif
+         * (systems ne change pas pendant update): une recherche n'échoue jamais
+         */
+        struct SystemCacheBase
+        {
+            virtual ~SystemCacheBase() = default;
+            virtual void rebuild(const std::vector<std::unique_ptr<System>> &systems) = 0;
+            std::size_t version = 0;
+        };
+
+        template <typename T>
+        struct SystemCache : SystemCacheBase
+        {
+            std::vector<T *> systems;
+
+            void rebuild(const std::vector<std::unique_ptr<System>> &allSystems) override
+            {
+                systems.clear();
+                for (auto &system : allSystems)
+                {
+                    if (T *castedSystem = dynamic_cast<T *>(system.get()))
+                    {
+                        systems.push_back(castedSystem);
+                    }
+                }
+            }
+        };
+
+        std::vector<std::unique_ptr<SystemCacheBase>> systemCaches;
+        std::size_t systemsVersion = 1;         // Incrémenté à chaque ajout/retrait/réordonnancement
+        std::vector<System *> reorderedSystems; // Priorité changée: replacés avant le prochain update()
+        bool runningSystems = false;            // Parcours de systems en cours (update/render)
+        bool runningParallel = false;           // update() en cours sur le pool de threads
+        std::shared_mutex systemCacheMutex;     // Protège systemCaches pendant runningParallel
+
+        template <typename T>
+        SystemCache<T> &getSystemCache()
+        {
+            applySystemOrder();
+
+            std::size_t typeID = getSystemTypeID<T>();
+            if (runningParallel)
+            {
+                {
+                    std::shared_lock<std::shared_mutex> lock(systemCacheMutex);
+                    if (typeID < systemCaches.size() && systemCaches[typeID])
+                    {
+                        return static_cast<SystemCache<T> &>(*systemCaches[typeID]);
+                    }
+                }
+                std::unique_lock<std::shared_mutex> lock(systemCacheMutex);
+                return buildSystemCache<T>(typeID);
+            }
+            return buildSystemCache<T>(typeID);
+        }
+
+        // Crée l'entrée de T si besoin et la remet à jour (verrou exclusif si parallèle)
+        template <typename T>
+        SystemCache<T> &buildSystemCache(std::size_t typeID)
+        {
+            if (typeID >= systemCaches.size())
+            {
+                systemCaches.resize(typeID + 1);
+            }
+            if (!systemCaches[typeID])
+            {
+                systemCaches[typeID] = std::make_unique<SystemCache<T>>();
+            }
+
+            auto &cache = static_cast<SystemCache<T> &>(*systemCaches[typeID]);
+            if (cache.version != systemsVersion)
+            {
+                cache.rebuild(systems);
+                cache.version = systemsVersion;
+            }
+            return cache;
+        }
+
+        // Remet à jour toutes les entrées avant que les systèmes tournent en parallèle
+        void refreshSystemCaches()
+        {
+            for (auto &cache : systemCaches)
+            {
+                if (cache && cache->version != systemsVersion)
+                {
+                    cache->rebuild(systems);
+                    cache->version = systemsVersion;
+                }
+            }
+        }
+
+        // Insère après les systèmes de priorité inférieure ou égale (tri stable)
+        void insertSystem(std::unique_ptr<System> system)
+        {
+            auto position = std::upper_bound(systems.begin(), systems.end(), system->getPriority(),
+                                             [](int priority, const std::unique_ptr<System> &other)
+                                             { return priority < other->getPriority(); });
+            systems.insert(position, std::move(system));
+            applyRunAfter();
+            ++systemsVersion;
+            scheduleDirty = true;
+        }
+
+        /*
+         * Déplace chaque système déclarant runAfter<T>() juste après le dernier
+         * système T qui le précédait encore (l'ordre des priorités est gardé sinon)
+         */
+        void applyRunAfter()
+        {
+            // Chaque déplacement avance un système: au-delà de n² déplacements, il y a un cycle
+            std::size_t moves = 0;
+            for (std::size_t i = 0; i < systems.size();)
+            {
+                std::size_t last = i;
+                for (std::size_t j = i + 1; j < systems.size(); ++j)
+                {
+                    if (systems[i]->mustRunAfter(*systems[j]))
+                    {
+                        last = j;
+                    }
+                }
+
+                if (last == i)
+                {
+                    ++i;
+                    continue;
+                }
+                if (++moves > systems.size() * systems.size())
+                {
+                    std::cerr << "[ECS] WARNING: cycle in System::runAfter constraints, some are not respected\n";
+                    return;
+                }
+                std::rotate(systems.begin() + i, systems.begin() + i + 1, systems.begin() + last + 1);
+            }
+        }
+
+        /*
+         * Replace les systèmes dont la priorité a changé (System::setPriority)
+         * Différé tant que systems est parcouru: l'ordre d'un update() en cours ne change pas
+         */
+        void applySystemOrder()
+        {
+            if (reorderedSystems.empty() || runningSystems)
+            {
+                return;
+            }
+            for (System *system : reorderedSystems)
+            {
+                placeSystem(*system);
+            }
+            reorderedSystems.clear();
+            ++systemsVersion;
+            scheduleDirty = true;
+        }
+
+        /*
+         * Déplace un seul système: après ceux de priorité inférieure ou égale et
+         * après ceux qu'il doit suivre (runAfter), sans retrier les autres
+         */
+        void placeSystem(System &system)
+        {
+            auto it = std::find_if(systems.begin(), systems.end(),
+                                   [&system](const std::unique_ptr<System> &s)
+                                   { return s.get() == &system; });
+            std::unique_ptr<System> moved = std::move(*it);
+            systems.erase(it);
+
+            std::size_t position = 0;
+            while (position < systems.size() && systems[position]->getPriority() <= system.getPriority())
+            {
+                ++position;
+            }
+            for (std::size_t j = position; j < systems.size(); ++j)
+            {
+                if (system.mustRunAfter(*systems[j]))
+                {
+                    position = j + 1;
+                }
+            }
+
+            // Un système placé avant lui doit le suivre: les contraintes sont réappliquées
+            bool dependentBefore = false;
+            for (std::size_t j = 0; j < position && !dependentBefore; ++j)
+            {
+                dependentBefore = systems[j]->mustRunAfter(system);
+            }
+            systems.insert(systems.begin() + position, std::move(moved));
+            if (dependentBefore)
+            {
+                applyRunAfter();
+            }
+        }
+
+        friend class Entity;
+        friend class System;
+
+        /*
+         * Cache des requêtes: signature demandée -> archetypes qui la contiennent
+         * Les archetypes ne sont jamais supprimés, il suffit donc de tester
+         * ceux créés depuis la dernière consultation
+         */
+        struct QueryCache
+        {
+            std::vector<Internal::Archetype *> archetypes;
+            std::size_t scannedCount = 0;
+        };
+        std::unordered_map<ComponentBitSet, QueryCache, ComponentBitSet::Hash> queryCaches;
+        std::shared_mutex queryCacheMutex; // view() est appelé depuis les update() parallèles
+
+        /*
+         * La référence retournée reste valide (les nœuds de l'unordered_map ne bougent
+         * pas au rehash); la liste n'est complétée que si des archetypes sont apparus,
+         * ce qui n'arrive pas pendant les update() parallèles (passer par le CommandBuffer)
+         */
+        const std::vector<Internal::Archetype *> &getMatchingArchetypes(const ComponentBitSet &mask)
+        {
+            // Cas courant, cache déjà à jour: verrou partagé, les systèmes ne s'attendent pas
+            {
+                std::shared_lock<std::shared_mutex> lock(queryCacheMutex);
+                auto it = queryCaches.find(mask);
+                if (it != queryCaches.end() && it->second.scannedCount == archetypeList.size())
+                {
+                    return it->second.archetypes;
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(queryCacheMutex);
+            QueryCache &cache = queryCaches[mask];
+            for (; cache.scannedCount < archetypeList.size(); ++cache.scannedCount)
+            {
+                Internal::Archetype *archetype = archetypeList[cache.scannedCount];
+                if (archetype->signature.containsAll(mask))
+                {
+                    cache.archetypes.push_back(archetype);
+                }
+            }
+            return cache.archetypes;
+        }
+
+        /*
+         * Récupère (ou crée) l'archetype correspondant à une signature
+         */
+        Internal::Archetype &getArchetype(const ComponentBitSet &signature)
+        {
+            auto it = archetypes.find(signature);
+            if (it != archetypes.end())
+            {
+                return *it->second;
+            }
+
+            auto archetype = std::make_unique<Internal::Archetype>(signature, chunkAllocator);
+            Internal::Archetype *archetypePtr = archetype.get();
+            archetypes.emplace(signature, std::move(archetype));
+            archetypeList.push_back(archetypePtr);
+            return *archetypePtr;
+        }
+
+        /*
+         * Archetype voisin (un type en plus ou en moins), mémorisé dans les deux sens
+         * pour éviter la recherche par signature aux ajouts/retraits suivants
+         */
+        Internal::Archetype &getArchetypeWith(Internal::Archetype &source, ComponentID typeID)
+        {
+            Internal::Archetype *&edge = source.addEdges[typeID];
+            if (!edge)
+            {
+                ComponentBitSet signature = source.signature;
+                signature.set(typeID);
+                edge = &getArchetype(signature);
+                edge->removeEdges[typeID] = &source;
+            }
+            return *edge;
+        }
+
+        Internal::Archetype &getArchetypeWithout(Internal::Archetype &source, ComponentID typeID)
+        {
+            Internal::Archetype *&edge = source.removeEdges[typeID];
+            if (!edge)
+            {
+                ComponentBitSet signature = source.signature;
+                signature.reset(typeID);
+                edge = &getArchetype(signature);
+                edge->addEdges[typeID] = &source;
+            }
+            return *edge;
+        }
+
+        /*
+         * Déplace les composants d'une entité vers un autre archetype
+         * Les colonnes absentes de la cible sont détruites, les nouvelles restent à construire
+         * changedType: le type ajouté/retiré (seuls ses systèmes seront re-testés)
+         */
+        void moveEntity(Entity &entity, Internal::Archetype &target, ComponentID changedType)
+        {
+            Internal::Archetype &source = *entity.archetype;
+            auto location = target.allocateRow(&entity);
+
+            for (std::size_t c = 0; c < target.columns.size(); ++c)
+            {
+                int sourceColumn = source.columnIndex[target.columns[c].type];
+                if (sourceColumn >= 0)
+                {
+                    target.columns[c].info.moveConstruct(target.getSlot(c, location.first, location.second),
+                                                         source.getSlot(sourceColumn, entity.chunkIndex, entity.chunkRow));
+                    target.getTick(c, location.first, location.second) = source.getTick(sourceColumn, entity.chunkIndex, entity.chunkRow);
+                }
+            }
+
+            removeFromArchetype(entity);
+            entity.archetype = &target;
+            entity.chunkIndex = static_cast<std::uint32_t>(location.first);
+            entity.chunkRow = static_cast<std::uint32_t>(location.second);
+            markDirty(entity, changedType);
+        }
+
+        /*
+         * Place une entité dans un slot libre et lui réserve une ligne dans l'archetype
+         * (les composants de la ligne ne sont PAS construits)
+         */
+        Entity &spawnEntity(EntityHandle handle, EntityID id, Internal::Archetype &archetype)
+        {
+            // L'objet Entity d'un slot recyclé est réinitialisé plutôt que réalloué
+            EntitySlot &slot = slots[handle.index];
+            if (slot.storage)
+            {
+                *slot.storage = Entity(this, id, handle);
+            }
+            else
+            {
+                slot.storage = std::make_unique<Entity>(this, id, handle);
+            }
+            Entity *entityPtr = slot.storage.get();
+            slot.entity = entityPtr;
+
+            auto location = archetype.allocateRow(entityPtr);
+            entityPtr->archetype = &archetype;
+            entityPtr->chunkIndex = static_cast<std::uint32_t>(location.first);
+            entityPtr->chunkRow = static_cast<std::uint32_t>(location.second);
+            markDirty(*entityPtr);
+
+            entityPtr->entityIndex = static_cast<std::uint32_t>(entities.size());
+            entities.push_back(entityPtr);
+            return *entityPtr;
+        }
+
+        // Vrai si le handle est vivant et que son entité fait partie du système
+        bool isMember(const System &system, EntityHandle handle) const
+        {
+            const Entity *entity = getEntity(handle);
+            return entity && system.contains(*entity);
+        }
+
+        // Création/destruction: l'entité sera re-testée par tous les systèmes
+        void markDirty(Entity &entity)
+        {
+            entity.membershipFullCheck = true;
+            queueMembershipUpdate(entity);
+        }
+
+        // Ajout/retrait d'un type: seuls les systèmes qui le requièrent sont concernés
+        void markDirty(Entity &entity, ComponentID changedType)
+        {
+            entity.changedComponents.set(changedType);
+            queueMembershipUpdate(entity);
+        }
+
+        // Listes des layers: même principe que les listes d'entités des systèmes
+        void addToLayer(Entity &entity, Layer layer)
+        {
+            LayerList &list = layerLists[layer];
+            std::uint32_t slot = entity.handle.index;
+            if (slot >= list.positions.size())
+            {
+                list.positions.resize(slot + 1);
+            }
+            list.positions[slot] = static_cast<std::uint32_t>(list.entities.size());
+            list.entities.push_back(&entity);
+        }
+
+        void removeFromLayer(Entity &entity, Layer layer)
+        {
+            LayerList &list = layerLists[layer];
+            std::uint32_t position = list.positions[entity.handle.index];
+            Entity *last = list.entities.back();
+            list.entities[position] = last;
+            list.positions[last->handle.index] = position;
+            list.entities.pop_back();
+        }
+
+        // Index des tags: ajout en fin de liste, retrait par swap-and-pop
+        void tagEntity(Entity &entity, TagID tag)
+        {
+            untagEntity(entity);
+            entity.tag = tag;
+            if (tag == NO_TAG)
+            {
+                return;
+            }
+
+            if (tag >= taggedEntities.size())
+            {
+                taggedEntities.resize(tag + 1);
+            }
+            std::vector<Entity *> &tagged = taggedEntities[tag];
+            entity.tagIndex = static_cast<std::uint32_t>(tagged.size());
+            tagged.push_back(&entity);
+        }
+
+        void untagEntity(Entity &entity)
+        {
+            if (entity.tag == NO_TAG)
+            {
+                return;
+            }
+
+            std::vector<Entity *> &tagged = taggedEntities[entity.tag];
+            Entity *last = tagged.back();
+            tagged[entity.tagIndex] = last;
+            last->tagIndex = entity.tagIndex;
+            tagged.pop_back();
+            entity.tag = NO_TAG;
+        }
+
+        void recordAdded(Entity &entity, ComponentID typeID)
+        {
+            if (observedAdded[typeID])
+            {
+                observedTypes[typeID].added.push_back(entity.handle);
+            }
+        }
+
+        void recordRemoved(Entity &entity, ComponentID typeID)
+        {
+            if (observedRemoved[typeID])
+            {
+                observedTypes[typeID].removed.push_back(entity.handle);
+            }
+        }
+
+        /*
+         * Envoie les batchs accumulés depuis le dernier refresh()
+         * Les changements faits par les callbacks partent au plus tard au flush suivant
+         */
+        void flushObservers()
+        {
+            // Fenêtre [since, observerTick): les écritures des callbacks prennent le
+            // nouveau tick et partent au flush suivant, une seule fois
+            std::uint32_t since = observerTick;
+            observerTick = ++changeTick;
+
+            for (std::size_t t = 0; t < observedTypeList.size(); ++t)
+            {
+                ComponentID typeID = observedTypeList[t];
+
+                std::vector<EntityHandle> added, removed, changed;
+                added.swap(observedTypes[typeID].added);
+                removed.swap(observedTypes[typeID].removed);
+
+                // Changed: lecture des ticks, colonne par colonne (thread-safe côté écriture)
+                if (observedChanged[typeID])
+                {
+                    ComponentBitSet mask;
+                    mask.set(typeID);
+                    for (Internal::Archetype *archetype : getMatchingArchetypes(mask))
+                    {
+                        std::size_t column = archetype->columnIndex[typeID];
+                        for (std::size_t chunk = 0; chunk < archetype->chunks.size(); ++chunk)
+                        {
+                            Entity **chunkEntities = archetype->getEntities(chunk);
+                            for (std::size_t row = 0; row < archetype->chunks[chunk].count; ++row)
+                            {
+                                std::uint32_t tick = archetype->getTick(column, chunk, row);
+                                if (tick >= since && tick < observerTick)
+                                {
+                                    changed.push_back(chunkEntities[row]->handle);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Index plutôt qu'itérateur: un callback peut ajouter un observer
+                for (std::size_t o = 0; o < observedTypes[typeID].observers.size(); ++o)
+                {
+                    Observer observer = observedTypes[typeID].observers[o];
+                    const std::vector<EntityHandle> &batch = observer.event == ComponentEvent::Added     ? added
+                                                             : observer.event == ComponentEvent::Removed ? removed
+                                                                                                         : changed;
+                    if (observer.callback && !batch.empty())
+                    {
+                        observer.callback(batch);
+                    }
+                }
+
+                auto &observers = observedTypes[typeID].observers;
+                observers.erase(std::remove_if(observers.begin(), observers.end(),
+                                               [](const Observer &observer)
+                                               { return !observer.callback; }),
+                                observers.end());
+            }
+        }
+
+        void queueMembershipUpdate(Entity &entity)
+        {
+            if (!entity.membershipDirty)
+            {
+                entity.membershipDirty = true;
+                dirtyEntities.push_back(&entity);
+            }
+        }
+
+        /*
+         * Ajoute/retire l'entité d'un système selon sa signature actuelle
+         */
+        void updateMembership(System &system, Entity &entity)
+        {
+            bool matches = entity.isActive() && system.matchesSignature(entity);
+            bool member = system.contains(entity);
+
+            if (matches && !member)
+            {
+                system.addEntity(&entity);
+                system.onEntityAdded(&entity);
+            }
+            else if (!matches && member)
+            {
+                system.removeEntity(&entity);
+                system.onEntityRemoved(&entity);
+            }
+        }
+
+        /*
+         * Retire la ligne d'une entité de son archetype (composants détruits)
+         */
+        void removeFromArchetype(Entity &entity)
+        {
+            Entity *moved = entity.archetype->removeRow(entity.chunkIndex, entity.chunkRow);
+            if (moved)
+            {
+                moved->chunkIndex = entity.chunkIndex;
+                moved->chunkRow = entity.chunkRow;
+            }
+        }
+
+        /*
+         * Retire des entités que personne n'a encore vues (loadSnapshot échoué):
+         * ni observers Removed, ni systèmes, ni destroy() différé
+         */
+        void discardUnannounced(const std::vector<Entity *> &discarded)
+        {
+            for (Entity *entity : discarded)
+            {
+                untagEntity(*entity);
+                for (Layer layer = 0; layer < MAX_LAYERS; ++layer)
+                {
+                    if (entity->layers.test(layer))
+                    {
+                        removeFromLayer(*entity, layer);
+                    }
+                }
+                removeFromArchetype(*entity);
+                entity->archetype = nullptr;
+
+                Entity *last = entities.back();
+                entities[entity->entityIndex] = last;
+                last->entityIndex = entity->entityIndex;
+                entities.pop_back();
+                slots[entity->handle.index].entity = nullptr;
+            }
+
+            // Plus de synchro avec les systèmes pour elles
+            dirtyEntities.erase(std::remove_if(dirtyEntities.begin(), dirtyEntities.end(),
+                                               [this](Entity *entity)
+                                               { return slots[entity->handle.index].entity != entity; }),
+                                dirtyEntities.end());
+        }
+
+        /*
+         * Graphe de dépendances: un système attend chaque système précédent
+         * (en priorité) avec lequel il est en conflit d'accès
+         * Reconstruit seulement quand la liste ou l'ordre des systèmes change
+         */
+        void buildSchedule()
+        {
+            systemDependents.assign(systems.size(), {});
+            systemDependencyCount.assign(systems.size(), 0);
+
+            for (std::size_t i = 0; i < systems.size(); ++i)
+            {
+                for (std::size_t j = 0; j < i; ++j)
+                {
+                    if (systems[i]->conflictsWith(*systems[j]) || systems[i]->mustRunAfter(*systems[j]))
+                    {
+                        systemDependents[j].push_back(i);
+                        ++systemDependencyCount[i];
+                    }
+                }
+            }
+            scheduleDirty = false;
+        }
+
+        /*
+         * Ajoute deltaTime à l'accumulateur de chaque cadence fixe et calcule le
+         * nombre de pas à rattraper cette frame (plafonné à maxFixedSteps)
+         * Retourne le nombre de passes nécessaires (au moins 1)
+         */
+        std::size_t prepareFixedSteps(float deltaTime)
+        {
+            for (auto &system : systems)
+            {
+                if (!system->isFixedRate())
+                {
+                    continue;
+                }
+
+                std::size_t index = 0;
+                while (index < fixedRates.size() && fixedRates[index].interval != system->updateInterval)
+                {
+                    ++index;
+                }
+                if (index == fixedRates.size())
+                {
+                    fixedRates.push_back({system->updateInterval});
+                }
+                system->fixedRateIndex = index;
+            }
+
+            std::size_t passes = 1;
+            for (auto &rate : fixedRates)
+            {
+                rate.accumulator += deltaTime;
+                rate.steps = static_cast<std::size_t>(rate.accumulator / rate.interval);
+                if (rate.steps > maxFixedSteps)
+                {
+                    rate.steps = maxFixedSteps;
+                }
+                rate.accumulator -= static_cast<float>(rate.steps) * rate.interval;
+                if (rate.accumulator >= rate.interval)
+                {
+                    // Retard abandonné: on ne garde que la fraction du pas en cours
+                    rate.accumulator = std::fmod(rate.accumulator, rate.interval);
+                }
+                passes = std::max(passes, rate.steps);
+            }
+            return passes;
+        }
+
+        // Sélectionne les systèmes de la passe: une fois par frame (passe 0) ou un pas fixe restant
+        void selectPass(std::size_t pass)
+        {
+            systemActive.assign(systems.size(), 0);
+            for (std::size_t i = 0; i < systems.size(); ++i)
+            {
+                const System &system = *systems[i];
+                systemActive[i] = system.isFixedRate() ? pass < fixedRates[system.fixedRateIndex].steps
+                                                       : pass == 0;
+            }
+        }
+
+        void runSystem(System &system, float deltaTime)
+        {
+#if ECS_ENABLE_PROFILER
+            std::uint64_t start = Profiler::now();
+#endif
+            system.update(system.isFixedRate() ? system.updateInterval : deltaTime);
+            system.lastRunTick = changeTick;
+#if ECS_ENABLE_PROFILER
+            std::uint64_t end = Profiler::now();
+            Profiler::record(system.updateProfileName, start, end);
+            system.updateTimes.add(static_cast<float>(end - start) / 1e6f);
+#endif
+        }
+
+        float fixedRateAlpha(float interval) const
+        {
+            for (const auto &rate : fixedRates)
+            {
+                if (rate.interval == interval)
+                {
+                    return rate.accumulator / rate.interval;
+                }
+            }
+            return 0.0f; // Aucun update() encore: pas d'état précédent à rattraper
+        }
+
+        void runSystemsParallel(float deltaTime)
+        {
+            if (scheduleDirty)
+            {
+                buildSchedule();
+            }
+
+            // Seules les dépendances vers des systèmes actifs cette passe comptent
+            std::vector<std::atomic<std::size_t>> remaining(systems.size());
+            for (auto &count : remaining)
+            {
+                count = 0;
+            }
+            std::size_t activeCount = 0;
+            for (std::size_t i = 0; i < systems.size(); ++i)
+            {
+                if (!systemActive[i])
+                {
+                    continue;
+                }
+                ++activeCount;
+                for (std::size_t dependent : systemDependents[i])
+                {
+                    if (systemActive[dependent])
+                    {
+                        ++remaining[dependent];
+                    }
+                }
+            }
+            std::atomic<std::size_t> pending{activeCount};
+
+            // Racines relevées avant le premier submit: ensuite, remaining est
+            // décrémenté par les workers (une relecture lancerait un système deux fois)
+            std::vector<std::size_t> roots;
+            for (std::size_t i = 0; i < systems.size(); ++i)
+            {
+                if (systemActive[i] && remaining[i] == 0)
+                {
+                    roots.push_back(i);
+                }
+            }
+
+            // Exception d'un système: gardée pour le thread appelant. Les systèmes
+            // suivants sont sautés mais toujours comptés, pour que wait() se termine
+            // avant que cette fonction (et ce que les tâches référencent) disparaisse
+            std::exception_ptr error;
+            std::mutex errorMutex;
+            std::atomic<bool> failed{false};
+
+            // Lance un système puis libère ceux qui n'attendaient plus que lui
+            std::function<void(std::size_t)> run = [&](std::size_t index)
+            {
+                if (!failed.load(std::memory_order_acquire))
+                {
+                    try
+                    {
+                        runSystem(*systems[index], deltaTime);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                        failed.store(true, std::memory_order_release);
+                    }
+                }
+
+                for (std::size_t dependent : systemDependents[index])
+                {
+                    if (systemActive[dependent] && --remaining[dependent] == 0)
+                    {
+                        threadPool->submit([&run, dependent]
+                                           { run(dependent); });
+                    }
+                }
+                pending.fetch_sub(1, std::memory_order_release);
+            };
+
+            for (std::size_t i : roots)
+            {
+                threadPool->submit([&run, i]
+                                   { run(i); });
+            }
+            threadPool->wait(pending);
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+    public:
+        // ====================================================================
+        // ENTITY MANAGEMENT
+        // ====================================================================
+
+        /*
+         * Cr�e une nouvelle entit�
+         * Retourne une r�f�rence vers l'entit� cr��e
+         */
+        Entity &createEntity()
+        {
+            // Réutilise un slot libéré si possible (sa génération a déjà été incrémentée)
+            EntityHandle handle;
+            if (!freeSlots.empty())
+            {
+                handle.index = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                handle.index = static_cast<std::uint32_t>(slots.size());
+                slots.emplace_back();
+            }
+            handle.generation = slots[handle.index].generation;
+
+            // Une nouvelle entité commence dans l'archetype vide
+            return spawnEntity(handle, nextEntityID++, getArchetype(ComponentBitSet()));
+        }
+
+        /*
+         * Cr�e une entit� avec un tag
+         */
+        Entity &createEntity(const std::string &tag)
+        {
+            Entity &entity = createEntity();
+            entity.setTag(tag);
+            return entity;
+        }
+
+        /*
+         * R�cup�re toutes les entit�s
+         */
+        const std::vector<Entity *> &getEntities() const
+        {
+            return entities;
+        }
+
+        /*
+         * Crée une View sur toutes les entités qui possèdent les composants Ts...
+         * Voir la classe View pour les modes de parcours
+         */
+        template <typename... Ts>
+        View<Ts...> view()
+        {
+            ComponentBitSet mask;
+            (mask.set(getComponentTypeID<Ts>()), ...);
+            return View<Ts...>(getMatchingArchetypes(mask), threadPool.get(), changeTick);
+        }
+
+        /*
+         * Buffer de commandes du Manager, rejoué au début de refresh()
+         * À utiliser depuis les systèmes (surtout en parallèle) plutôt que
+         * createEntity/addComponent/removeComponent/destroy directement
+         */
+        CommandBuffer &getCommandBuffer() { return commandBuffer; }
+
+        /*
+         * Résout un handle en entité
+         * Retourne nullptr si le handle est nul ou si l'entité a été détruite depuis
+         */
+        Entity *getEntity(EntityHandle handle) const
+        {
+            if (handle.index >= slots.size())
+            {
+                return nullptr;
+            }
+
+            const EntitySlot &slot = slots[handle.index];
+            return slot.generation == handle.generation ? slot.entity : nullptr;
+        }
+
+        bool isValid(EntityHandle handle) const
+        {
+            return getEntity(handle) != nullptr;
+        }
+
+        /*
+         * R�cup�re une entit� par son tag
+         * Retourne nullptr si aucune entit� n'a ce tag
+         */
+        Entity *getEntityByTag(TagID tag) const
+        {
+            const std::vector<Entity *> &tagged = getEntitiesByTag(tag);
+            return tagged.empty() ? nullptr : tagged.front();
+        }
+
+        Entity *getEntityByTag(const std::string &tag) const
+        {
+            return getEntityByTag(findTagID(tag));
+        }
+
+        /*
+         * Toutes les entités qui portent un tag (sans allocation, ordre non garanti)
+         * Exemple: for (ECS::Entity *enemy : manager.getEntitiesByTag(ENEMY)) { ... }
+         */
+        const std::vector<Entity *> &getEntitiesByTag(TagID tag) const
+        {
+            static const std::vector<Entity *> none;
+            return (tag != NO_TAG && tag < taggedEntities.size()) ? taggedEntities[tag] : none;
+        }
+
+        const std::vector<Entity *> &getEntitiesByTag(const std::string &tag) const
+        {
+            return getEntitiesByTag(findTagID(tag));
+        }
+
+        /*
+         * R�cup�re toutes les entit�s d'un layer sp�cifique
+         * Liste maintenue à jour (pas de parcours ni d'allocation), ordre non garanti
+         * Ne pas ajouter/retirer ce layer pendant le parcours
+         */
+        const std::vector<Entity *> &getEntitiesByLayer(Layer layer) const
+        {
+            static const std::vector<Entity *> none;
+            return layer < MAX_LAYERS ? layerLists[layer].entities : none;
+        }
+
+        /*
+         * Appelle func(Entity*) sur chaque entité présente dans TOUS les layers du masque
+         * Seule la liste du plus petit layer est parcourue
+         *
+         * Exemple (Enemy et Collidable):
+         *   ECS::LayerBitSet mask;
+         *   mask.set(ENEMY).set(COLLIDABLE);
+         *   manager.forEachInLayers(mask, [](ECS::Entity *entity) { ... });
+         */
+        template <typename Func>
+        void forEachInLayers(const LayerBitSet &mask, Func &&func) const
+        {
+            const std::vector<Entity *> *smallest = nullptr;
+            for (Layer layer = 0; layer < MAX_LAYERS; ++layer)
+            {
+                if (mask[layer] && (!smallest || layerLists[layer].entities.size() < smallest->size()))
+                {
+                    smallest = &layerLists[layer].entities;
+                }
+            }
+            if (!smallest)
+            {
+                return;
+            }
+
+            for (Entity *entity : *smallest)
+            {
+                if ((entity->getLayers() & mask) == mask)
+                {
+                    func(entity);
+                }
+            }
+        }
+
+        /*
+         * Supprime les entit�s marqu�es comme inactives
+         * � appeler � la fin de chaque frame
+         */
+        void refresh()
+        {
+            ECS_PROFILE_SCOPE("Manager::refresh");
+
+            // Application des changements différés pendant la frame
+            commandBuffer.playback(*this);
+
+            // Mise � jour des syst�mes avant suppression
+            // (les entités détruites sont dans dirtyEntities, voir Entity::destroy)
+            updateSystemEntities();
+
+            // Suppression des entit�s inactives
+            // Seules les entités détruites sont visitées (pas de parcours de toute la liste)
+            for (Entity *entity : pendingDestroy)
+            {
+                // Retrait de l'index des tags
+                untagEntity(*entity);
+
+                // Observers Removed: chaque composant encore présent
+                (entity->archetype->signature & observedRemoved).forEach([&](ComponentID typeID)
+                                                                          { recordRemoved(*entity, typeID); });
+
+                // Destruction des composants dans l'archetype
+                removeFromArchetype(*entity);
+                entity->archetype = nullptr;
+
+                // Retrait de la liste dense par swap-and-pop
+                Entity *last = entities.back();
+                entities[entity->entityIndex] = last;
+                last->entityIndex = entity->entityIndex;
+                entities.pop_back();
+
+                // Le slot est invalidé puis recyclé (l'objet Entity reste alloué)
+                EntitySlot &slot = slots[entity->handle.index];
+                slot.entity = nullptr;
+                ++slot.generation;
+                freeSlots.push_back(entity->handle.index);
+            }
+            pendingDestroy.clear();
+
+            flushObservers();
+        }
+
+        // ====================================================================
+        // RESOURCES
+        // ====================================================================
+
+        /*
+         * Crée la ressource T, ou la remplace par une nouvelle valeur
+         * L'adresse reste la même en cas de remplacement (rechargement de map...):
+         * les pointeurs obtenus via resource<T>() restent valides
+         */
+        template <typename T, typename... TArgs>
+        T &setResource(TArgs &&...args)
+        {
+            std::size_t typeID = getResourceTypeID<T>();
+            if (typeID >= resources.size())
+            {
+                resources.resize(typeID + 1);
+            }
+
+            if (!resources[typeID])
+            {
+                auto holder = std::make_unique<Internal::ResourceHolder<T>>(std::forward<TArgs>(args)...);
+                T &value = holder->value;
+                resources[typeID] = std::move(holder);
+                return value;
+            }
+
+            // Construite avant le remplacement: si le constructeur lève, l'ancienne reste intacte
+            T replacement(std::forward<TArgs>(args)...);
+            T &value = static_cast<Internal::ResourceHolder<T> &>(*resources[typeID]).value;
+            Internal::replaceValue(value, std::move(replacement));
+            return value;
+        }
+
+        // Accès O(1), nullptr si la ressource n'existe pas
+        template <typename T>
+        T *resource() const
+        {
+            std::size_t typeID = getResourceTypeID<T>();
+            if (typeID >= resources.size() || !resources[typeID])
+            {
+                return nullptr;
+            }
+            return &static_cast<Internal::ResourceHolder<T> &>(*resources[typeID]).value;
+        }
+
+        template <typename T>
+        bool hasResource() const
+        {
+            return resource<T>() != nullptr;
+        }
+
+        // ATTENTION: invalide les pointeurs vers la ressource (préférer setResource pour remplacer)
+        template <typename T>
+        void removeResource()
+        {
+            std::size_t typeID = getResourceTypeID<T>();
+            if (typeID < resources.size())
+            {
+                resources[typeID].reset();
+            }
+        }
+
+        // ====================================================================
+        // SNAPSHOTS
+        // ====================================================================
+
+        /*
+         * Écrit toutes les entités et leurs composants enregistrés (voir
+         * ECS::registerComponent) à la fin de output, en binaire
+         *
+         * Format: les entités sont écrites archetype par archetype; chaque composant
+         * Raw est une colonne contiguë copiée par memcpy, chaque composant Custom un
+         * bloc écrit par son serializer. Les slots et générations des handles sont
+         * conservés: un EntityHandle sauvegardé dans un composant reste valide
+         * Les entités détruites depuis le dernier refresh() ne sont pas sauvegardées
+         *
+         * Exemple (GameState::SaveSelect):
+         *   std::vector<std::uint8_t> save;
+         *   manager.saveSnapshot(save);
+         */
+        void saveSnapshot(std::vector<std::uint8_t> &output) const
+        {
+            Internal::SerializerTable registry = Internal::copySerializers();
+            BinaryWriter out(output);
+
+            out.write(SNAPSHOT_MAGIC);
+            out.write(SNAPSHOT_VERSION);
+
+            // Table des composants: l'index dans la table remplace l'ID (propre à l'exécution)
+            std::vector<std::uint32_t> componentIndex(MAX_COMPONENTS, 0);
+            out.write(static_cast<std::uint32_t>(registry.byName.size()));
+            std::uint32_t nextComponent = 0;
+            for (ComponentID id = 0; id < MAX_COMPONENTS; ++id)
+            {
+                const Internal::SerializerInfo &info = registry.infos[id];
+                if (info.name.empty())
+                {
+                    continue;
+                }
+                componentIndex[id] = nextComponent++;
+                out.writeString(info.name);
+                out.write(info.mode);
+                out.write(static_cast<std::uint32_t>(info.rawSize));
+            }
+
+            // Table des tags utilisés (index 0: NO_TAG)
+            std::vector<std::uint32_t> tagIndex(taggedEntities.size(), 0);
+            std::vector<TagID> usedTags;
+            for (TagID tag = 1; tag < taggedEntities.size(); ++tag)
+            {
+                if (!taggedEntities[tag].empty())
+                {
+                    usedTags.push_back(tag);
+                    tagIndex[tag] = static_cast<std::uint32_t>(usedTags.size());
+                }
+            }
+            out.write(static_cast<std::uint32_t>(usedTags.size()));
+            for (TagID tag : usedTags)
+            {
+                out.writeString(getTagName(tag));
+            }
+
+            // Générations des slots (un slot détruit avant refresh() est déjà compté libre)
+            out.write(static_cast<std::uint64_t>(nextEntityID));
+            out.write(static_cast<std::uint32_t>(slots.size()));
+            for (const EntitySlot &slot : slots)
+            {
+                bool pendingDestroy = slot.entity && !slot.entity->isActive();
+                out.write(slot.generation + (pendingDestroy ? 1u : 0u));
+            }
+
+            out.write(static_cast<std::uint32_t>(archetypeList.size()));
+            std::vector<Entity *> rows;
+            std::vector<std::size_t> columns;
+            for (const Internal::Archetype *archetype : archetypeList)
+            {
+                rows.clear();
+                for (std::size_t chunk = 0; chunk < archetype->chunks.size(); ++chunk)
+                {
+                    Entity **chunkEntities = archetype->getEntities(chunk);
+                    for (std::size_t row = 0; row < archetype->chunks[chunk].count; ++row)
+                    {
+                        if (chunkEntities[row]->isActive())
+                        {
+                            rows.push_back(chunkEntities[row]);
+                        }
+                    }
+                }
+
+                columns.clear();
+                for (std::size_t c = 0; c < archetype->columns.size(); ++c)
+                {
+                    if (!registry.infos[archetype->columns[c].type].name.empty())
+                    {
+                        columns.push_back(c);
+                    }
+                }
+
+                out.write(static_cast<std::uint32_t>(columns.size()));
+                for (std::size_t c : columns)
+                {
+                    out.write(componentIndex[archetype->columns[c].type]);
+                }
+
+                out.write(static_cast<std::uint32_t>(rows.size()));
+                for (Entity *entity : rows)
+                {
+                    SnapshotEntity record;
+                    record.slot = entity->handle.index;
+                    record.tag = entity->tag < tagIndex.size() ? tagIndex[entity->tag] : 0;
+                    record.layers = static_cast<std::uint32_t>(entity->layers.to_ulong());
+                    record.id = entity->id;
+                    out.write(record);
+                }
+
+                // Une colonne = un bloc précédé de sa taille (un lecteur qui ne connaît
+                // pas le composant peut le sauter)
+                for (std::size_t c : columns)
+                {
+                    const Internal::SerializerInfo &info = registry.infos[archetype->columns[c].type];
+                    std::size_t sizeOffset = out.size();
+                    out.write(std::uint64_t(0));
+
+                    if (info.mode == SerializeMode::Raw)
+                    {
+                        std::uint8_t *block = out.allocate(rows.size() * info.rawSize);
+                        for (Entity *entity : rows)
+                        {
+                            const std::byte *component = static_cast<const std::byte *>(archetype->getSlot(c, entity->chunkIndex, entity->chunkRow));
+                            for (const Internal::RawField &field : info.rawFields)
+                            {
+                                std::memcpy(block, component + field.offset, field.size);
+                                block += field.size;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (Entity *entity : rows)
+                        {
+                            info.save(archetype->getSlot(c, entity->chunkIndex, entity->chunkRow), out);
+                        }
+                    }
+
+                    std::uint64_t blockSize = out.size() - sizeOffset - sizeof(std::uint64_t);
+                    std::memcpy(output.data() + sizeOffset, &blockSize, sizeof(blockSize));
+                }
+            }
+        }
+
+        bool saveSnapshot(const std::string &path) const
+        {
+            std::vector<std::uint8_t> buffer;
+            saveSnapshot(buffer);
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            if (!file)
+            {
+                std::cerr << "[ECS] ERROR: Failed to write snapshot: " << path << "\n";
+                return false;
+            }
+            return true;
+        }
+
+        /*
+         * Remplace le monde courant par celui du snapshot
+         * Les entités actuelles sont détruites (observers Removed, onEntityRemoved),
+         * puis les entités chargées sont signalées comme nouvelles au prochain update()
+         * Un composant du snapshot qui n'est plus enregistré est ignoré
+         * Retourne false si le snapshot est invalide: toute sa structure (tailles,
+         * index, slots, blocs Raw) est vérifiée avant de toucher au monde, qui reste
+         * alors intact. Seul un serializer Custom qui échoue en cours de chargement
+         * laisse un monde vide; rien n'a alors été annoncé (ni init(), ni observers)
+         */
+        bool loadSnapshot(const std::uint8_t *data, std::size_t size)
+        {
+            Internal::SerializerTable registry = Internal::copySerializers();
+            BinaryReader in(data, size);
+
+            if (in.read<std::uint32_t>() != SNAPSHOT_MAGIC || in.read<std::uint32_t>() != SNAPSHOT_VERSION)
+            {
+                std::cerr << "[ECS] ERROR: Not a snapshot (or unsupported version)\n";
+                return false;
+            }
+
+            // Les tailles lues sont bornées par ce qui reste à lire: un fichier corrompu
+            // ne peut pas déclencher d'allocation démesurée
+            auto readCount = [](BinaryReader &reader, std::size_t minBytesPerItem) -> std::size_t
+            {
+                std::size_t count = reader.read<std::uint32_t>();
+                if (count > reader.remaining() / minBytesPerItem)
+                {
+                    reader.consume(reader.remaining() + 1); // Marque le flux en échec
+                    return 0;
+                }
+                return count;
+            };
+
+            // Index de la table -> ID du composant dans cette exécution (INVALID: ignoré)
+            // Une entrée: nom (taille + octets), mode, taille Raw
+            constexpr ComponentID INVALID_COMPONENT = MAX_COMPONENTS;
+            std::vector<ComponentID> componentIDs(readCount(in, sizeof(std::uint32_t) + sizeof(SerializeMode) + sizeof(std::uint32_t)), INVALID_COMPONENT);
+            for (ComponentID &id : componentIDs)
+            {
+                std::string name = in.readString();
+                SerializeMode mode = in.read<SerializeMode>();
+                std::size_t rawSize = in.read<std::uint32_t>();
+
+                auto it = registry.byName.find(name);
+                if (it == registry.byName.end())
+                {
+                    continue;
+                }
+                const Internal::SerializerInfo &info = registry.infos[it->second];
+                if (info.mode != mode || (mode == SerializeMode::Raw && info.rawSize != rawSize))
+                {
+                    std::cerr << "[ECS] WARNING: Snapshot component '" << name << "' has changed, ignored\n";
+                    continue;
+                }
+                id = it->second;
+            }
+
+            // Noms seulement: internés une fois le fichier validé
+            std::vector<std::string> tagNames(readCount(in, sizeof(std::uint32_t)));
+            for (std::string &name : tagNames)
+            {
+                name = in.readString();
+            }
+
+            EntityID savedNextID = static_cast<EntityID>(in.read<std::uint64_t>());
+            std::uint32_t slotCount = in.read<std::uint32_t>();
+            const std::uint8_t *generations = in.consume(std::size_t(slotCount) * sizeof(std::uint32_t));
+            if (in.failed())
+            {
+                std::cerr << "[ECS] ERROR: Truncated snapshot\n";
+                return false;
+            }
+
+            // Première passe, sur une copie du lecteur: structure complète vérifiée
+            // sans rien créer (le chargement ne peut plus échouer que dans un serializer Custom)
+            auto validate = [&](BinaryReader reader) -> bool
+            {
+                std::vector<bool> usedSlots(slotCount, false);
+                std::uint32_t archetypeCount = reader.read<std::uint32_t>();
+                for (std::uint32_t a = 0; a < archetypeCount && !reader.failed(); ++a)
+                {
+                    std::vector<ComponentID> columns(readCount(reader, sizeof(std::uint32_t) + sizeof(std::uint64_t)));
+                    ComponentBitSet signature;
+                    for (ComponentID &id : columns)
+                    {
+                        std::uint32_t index = reader.read<std::uint32_t>();
+                        id = index < componentIDs.size() ? componentIDs[index] : INVALID_COMPONENT;
+                        if (id != INVALID_COMPONENT)
+                        {
+                            if (signature.test(id))
+                            {
+                                return false; // Même composant deux fois dans un archetype
+                            }
+                            signature.set(id);
+                        }
+                    }
+
+                    std::uint32_t entityCount = reader.read<std::uint32_t>();
+                    const std::uint8_t *records = reader.consume(std::size_t(entityCount) * sizeof(SnapshotEntity));
+                    if (!records)
+                    {
+                        return false;
+                    }
+                    for (std::uint32_t i = 0; i < entityCount; ++i)
+                    {
+                        SnapshotEntity record;
+                        std::memcpy(&record, records + i * sizeof(SnapshotEntity), sizeof(SnapshotEntity));
+                        if (record.slot >= slotCount || usedSlots[record.slot] || record.tag > tagNames.size())
+                        {
+                            return false;
+                        }
+                        usedSlots[record.slot] = true;
+                    }
+
+                    for (ComponentID id : columns)
+                    {
+                        std::size_t blockSize = static_cast<std::size_t>(reader.read<std::uint64_t>());
+                        if (!reader.consume(blockSize))
+                        {
+                            return false;
+                        }
+                        if (id != INVALID_COMPONENT && registry.infos[id].mode == SerializeMode::Raw &&
+                            blockSize != std::size_t(entityCount) * registry.infos[id].rawSize)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                return !reader.failed();
+            };
+            if (!validate(in))
+            {
+                std::cerr << "[ECS] ERROR: Corrupted snapshot\n";
+                return false;
+            }
+
+            clear();
+            std::vector<TagID> tags(tagNames.size() + 1, NO_TAG);
+            for (std::size_t i = 0; i < tagNames.size(); ++i)
+            {
+                tags[i + 1] = getTagID(tagNames[i]);
+            }
+            if (slots.size() < slotCount)
+            {
+                slots.resize(slotCount);
+            }
+            for (std::uint32_t i = 0; i < slotCount; ++i)
+            {
+                std::memcpy(&slots[i].generation, generations + i * sizeof(std::uint32_t), sizeof(std::uint32_t));
+            }
+            nextEntityID = savedNextID;
+
+            std::uint32_t archetypeCount = in.read<std::uint32_t>();
+            std::vector<ComponentID> fileColumns;
+            std::vector<Entity *> rows;
+            std::vector<Entity *> loaded;
+            bool valid = true;
+            for (std::uint32_t a = 0; a < archetypeCount && valid; ++a)
+            {
+                // Une colonne: index dans la table + taille de son bloc
+                fileColumns.resize(readCount(in, sizeof(std::uint32_t) + sizeof(std::uint64_t)));
+                ComponentBitSet signature;
+                for (ComponentID &id : fileColumns)
+                {
+                    std::uint32_t index = in.read<std::uint32_t>();
+                    id = index < componentIDs.size() ? componentIDs[index] : INVALID_COMPONENT;
+                    if (id != INVALID_COMPONENT)
+                    {
+                        signature.set(id);
+                    }
+                }
+                Internal::Archetype &archetype = getArchetype(signature);
+
+                // Entités, composants construits par défaut (la ligne est toujours valide)
+                std::uint32_t entityCount = in.read<std::uint32_t>();
+                const std::uint8_t *records = in.consume(std::size_t(entityCount) * sizeof(SnapshotEntity));
+                rows.clear();
+                for (std::uint32_t i = 0; i < entityCount; ++i)
+                {
+                    SnapshotEntity record;
+                    std::memcpy(&record, records + i * sizeof(SnapshotEntity), sizeof(SnapshotEntity));
+
+                    EntityHandle handle{record.slot, slots[record.slot].generation};
+                    Entity &entity = spawnEntity(handle, static_cast<EntityID>(record.id), archetype);
+                    for (std::size_t c = 0; c < archetype.columns.size(); ++c)
+                    {
+                        registry.infos[archetype.columns[c].type].construct(archetype.getSlot(c, entity.chunkIndex, entity.chunkRow));
+                    }
+                    tagEntity(entity, tags[record.tag]);
+                    entity.layers = LayerBitSet(record.layers);
+                    for (Layer layer = 0; layer < MAX_LAYERS; ++layer)
+                    {
+                        if (entity.layers.test(layer))
+                        {
+                            addToLayer(entity, layer);
+                        }
+                    }
+                    rows.push_back(&entity);
+                    loaded.push_back(&entity);
+                }
+
+                // Colonnes: copie brute ou serializer, bloc sauté si le composant est inconnu
+                for (std::size_t c = 0; c < fileColumns.size() && valid; ++c)
+                {
+                    std::size_t blockSize = static_cast<std::size_t>(in.read<std::uint64_t>());
+                    const std::uint8_t *block = in.consume(blockSize);
+                    ComponentID id = fileColumns[c];
+                    if (id == INVALID_COMPONENT)
+                    {
+                        continue;
+                    }
+
+                    const Internal::SerializerInfo &info = registry.infos[id];
+                    std::size_t column = static_cast<std::size_t>(archetype.columnIndex[id]);
+                    if (info.mode == SerializeMode::Raw)
+                    {
+                        for (Entity *entity : rows)
+                        {
+                            std::byte *component = static_cast<std::byte *>(archetype.getSlot(column, entity->chunkIndex, entity->chunkRow));
+                            for (const Internal::RawField &field : info.rawFields)
+                            {
+                                std::memcpy(component + field.offset, block, field.size);
+                                block += field.size;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        BinaryReader blockReader(block, blockSize);
+                        for (Entity *entity : rows)
+                        {
+                            info.load(archetype.getSlot(column, entity->chunkIndex, entity->chunkRow), blockReader);
+                        }
+                        valid = !blockReader.failed();
+                    }
+                }
+            }
+
+            if (valid)
+            {
+                // Même fin de vie qu'un addComponent (entity, tick, init(), observers),
+                // seulement une fois tout le snapshot chargé
+                for (Entity *entity : loaded)
+                {
+                    Internal::Archetype &archetype = *entity->archetype;
+                    for (std::size_t c = 0; c < archetype.columns.size(); ++c)
+                    {
+                        Component *component = archetype.columns[c].info.asComponent(archetype.getSlot(c, entity->chunkIndex, entity->chunkRow));
+                        component->entity = entity;
+                        archetype.getTick(c, entity->chunkIndex, entity->chunkRow) = changeTick;
+                        component->init();
+                        recordAdded(*entity, archetype.columns[c].type);
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "[ECS] ERROR: Corrupted snapshot (component serializer failed)\n";
+                discardUnannounced(loaded); // Pas de monde à moitié chargé
+            }
+
+            // Slots libres: les plus petits index sont réutilisés en premier
+            freeSlots.clear();
+            for (std::size_t i = slots.size(); i-- > 0;)
+            {
+                if (!slots[i].entity)
+                {
+                    freeSlots.push_back(static_cast<std::uint32_t>(i));
+                }
+            }
+            return valid;
+        }
+
+        bool loadSnapshot(const std::vector<std::uint8_t> &buffer)
+        {
+            return loadSnapshot(buffer.data(), buffer.size());
+        }
+
+        bool loadSnapshot(const std::string &path)
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file)
+            {
+                std::cerr << "[ECS] ERROR: Failed to open snapshot: " << path << "\n";
+                return false;
+            }
+
+            std::vector<std::uint8_t> buffer(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            return file && loadSnapshot(buffer);
+        }
+
+        /*
+         * Détruit toutes les entités immédiatement (systèmes et observers prévenus)
+         */
+        void clear()
+        {
+            for (Entity *entity : entities)
+            {
+                entity->destroy();
+            }
+            refresh();
+        }
+
+        // ====================================================================
+        // CLONING
+        // ====================================================================
+
+        /*
+         * Copie l'état du monde (entités, composants, tags, layers, appartenance aux
+         * systèmes) dans target, qui perd son contenu. Pour la prédiction avec
+         * rollback ou les simulations "et si" de l'IA:
+         *
+         *   ECS::Manager saved;
+         *   manager.cloneInto(saved);   // avant de prédire
+         *   ...
+         *   manager.restoreFrom(saved); // rollback
+         *
+         * Pas de createEntity/addComponent: les composants sont copiés colonne par
+         * colonne, chunk par chunk, et target réutilise ses chunks et ses objets
+         * Entity d'un clone à l'autre (préallouer avec target.reserveChunks)
+         *
+         * Les handles restent valides d'un monde à l'autre (mêmes slots et générations)
+         * Si target a les mêmes systèmes (mêmes types, même ordre), leurs listes sont
+         * copiées et seuls les entrants/sortants reçoivent onEntityAdded/onEntityRemoved;
+         * sinon l'appartenance est recalculée au prochain update()
+         * Tous les composants copiés sont vus comme modifiés par target (change detection)
+         *
+         * Non copiés: systèmes, ressources, observers et buffer de commandes de target
+         * (les événements d'observers en attente dans target sont abandonnés)
+         * Tous les composants doivent être copiables (sinon std::runtime_error, target intact)
+         */
+        void cloneInto(Manager &target) const
+        {
+            if (&target == this)
+            {
+                return;
+            }
+
+            for (const Internal::Archetype *archetype : archetypeList)
+            {
+                for (const auto &column : archetype->columns)
+                {
+                    if (archetype->entityCount > 0 && !column.info.copyRange)
+                    {
+                        throw std::runtime_error("cloneInto: composant non copiable");
+                    }
+                }
+            }
+
+            // Appartenance aux systèmes de target, avant que ses entités soient écrasées
+            bool sameSystems = systems.size() == target.systems.size();
+            for (std::size_t i = 0; sameSystems && i < systems.size(); ++i)
+            {
+                sameSystems = typeid(*systems[i]) == typeid(*target.systems[i]);
+            }
+
+            std::vector<std::vector<char>> wasMember(systems.size());
+            for (std::size_t i = 0; i < target.systems.size(); ++i)
+            {
+                System &targetSystem = *target.systems[i];
+                for (Entity *entity : targetSystem.entities)
+                {
+                    // Encore présente après la copie, dans le même système?
+                    if (!sameSystems || !isMember(*systems[i], entity->handle))
+                    {
+                        targetSystem.onEntityRemoved(entity);
+                    }
+                }
+
+                if (sameSystems)
+                {
+                    const System &system = *systems[i];
+                    wasMember[i].resize(system.entities.size());
+                    for (std::size_t e = 0; e < system.entities.size(); ++e)
+                    {
+                        EntityHandle handle = system.entities[e]->handle;
+                        wasMember[i][e] = target.isMember(targetSystem, handle);
+                    }
+                }
+            }
+
+            // Objets Entity: réutilisés slot par slot
+            target.slots.resize(slots.size());
+            for (std::size_t i = 0; i < slots.size(); ++i)
+            {
+                EntitySlot &targetSlot = target.slots[i];
+                targetSlot.generation = slots[i].generation;
+                targetSlot.entity = nullptr;
+                if (const Entity *entity = slots[i].entity)
+                {
+                    if (!targetSlot.storage)
+                    {
+                        targetSlot.storage = std::make_unique<Entity>(*entity);
+                    }
+                    else
+                    {
+                        *targetSlot.storage = *entity;
+                    }
+                    targetSlot.entity = targetSlot.storage.get();
+                    targetSlot.entity->manager = &target;
+                }
+            }
+            target.freeSlots = freeSlots;
+            target.nextEntityID = nextEntityID;
+
+            // Composants: copie en bloc archetype par archetype
+            target.changeTick = std::max(target.changeTick, changeTick);
+            for (Internal::Archetype *archetype : target.archetypeList)
+            {
+                archetype->clear();
+            }
+            for (const Internal::Archetype *archetype : archetypeList)
+            {
+                Internal::Archetype &targetArchetype = target.getArchetype(archetype->signature);
+                targetArchetype.copyFrom(*archetype, [&](Entity *entity)
+                                         {
+                                             Entity *copy = target.slots[entity->handle.index].entity;
+                                             copy->archetype = &targetArchetype;
+                                             return copy; },
+                                         target.changeTick);
+            }
+
+            // Listes d'entités: mêmes positions, pointeurs vers les objets de target
+            auto remapList = [&](std::vector<Entity *> &copy, const std::vector<Entity *> &source)
+            {
+                copy.resize(source.size());
+                for (std::size_t i = 0; i < source.size(); ++i)
+                {
+                    copy[i] = target.slots[source[i]->handle.index].entity;
+                }
+            };
+            remapList(target.entities, entities);
+            remapList(target.pendingDestroy, pendingDestroy);
+            remapList(target.dirtyEntities, dirtyEntities);
+            target.taggedEntities.resize(taggedEntities.size());
+            for (std::size_t tag = 0; tag < taggedEntities.size(); ++tag)
+            {
+                remapList(target.taggedEntities[tag], taggedEntities[tag]);
+            }
+            for (Layer layer = 0; layer < MAX_LAYERS; ++layer)
+            {
+                remapList(target.layerLists[layer].entities, layerLists[layer].entities);
+                target.layerLists[layer].positions = layerLists[layer].positions;
+            }
+
+            for (auto &entry : target.observedTypes)
+            {
+                entry.second.added.clear();
+                entry.second.removed.clear();
+            }
+
+            if (!sameSystems)
+            {
+                for (auto &system : target.systems)
+                {
+                    system->entities.clear();
+                    system->entityIndex.clear();
+                }
+                for (Entity *entity : target.entities)
+                {
+                    entity->membershipDirty = false;
+                }
+                target.dirtyEntities.clear();
+                for (Entity *entity : target.entities)
+                {
+                    target.markDirty(*entity);
+                }
+                return;
+            }
+
+            for (std::size_t i = 0; i < systems.size(); ++i)
+            {
+                System &targetSystem = *target.systems[i];
+                remapList(targetSystem.entities, systems[i]->entities);
+                targetSystem.entityIndex = systems[i]->entityIndex;
+                for (std::size_t e = 0; e < targetSystem.entities.size(); ++e)
+                {
+                    if (!wasMember[i][e])
+                    {
+                        targetSystem.onEntityAdded(targetSystem.entities[e]);
+                    }
+                }
+            }
+        }
+
+        // Revient à l'état sauvegardé par source.cloneInto (voir cloneInto)
+        void restoreFrom(const Manager &source)
+        {
+            source.cloneInto(*this);
+        }
+
+        // ====================================================================
+        // OBSERVERS
+        // ====================================================================
+
+        /*
+         * Abonne callback aux événements event du composant T (voir ComponentEvent)
+         * Retourne un ID pour unobserve()
+         */
+        template <typename T>
+        ObserverID observe(ComponentEvent event, ObserverCallback callback)
+        {
+            ComponentID typeID = getComponentTypeID<T>();
+            if (observedTypes.find(typeID) == observedTypes.end())
+            {
+                observedTypeList.push_back(typeID);
+            }
+
+            ObserverID id = nextObserverID++;
+            observedTypes[typeID].observers.push_back({id, event, std::move(callback)});
+
+            switch (event)
+            {
+            case ComponentEvent::Added:
+                observedAdded.set(typeID);
+                break;
+            case ComponentEvent::Removed:
+                observedRemoved.set(typeID);
+                break;
+            case ComponentEvent::Changed:
+                observedChanged.set(typeID);
+                break;
+            }
+            return id;
+        }
+
+        void unobserve(ObserverID id)
         {
-            // Mise � jour des syst�mes avant suppression
-            for (auto &system : systems)
+            for (auto &entry : observedTypes)
             {
-                system->entities.erase(
-                    std::remove_if(system->entities.begin(), system->entities.end(),
-                                   [&](Entity *entity)
-                                   {
-                                       bool shouldRemove = !entity->isActive() || !system->matchesSignature(*entity);
-                                       if (shouldRemove)
-                                       {
-                                           system->onEntityRemoved(entity);
-                                       }
-                                       return shouldRemove;
-                                   }),
-                    system->entities.end());
+                for (Observer &observer : entry.second.observers)
+                {
+                    if (observer.id == id)
+                    {
+                        observer.callback = nullptr;
+                    }
+                }
             }
-
-            // Suppression des entit�s inactives
-            entities.erase(
-                std::remove_if(entities.begin(), entities.end(),
-                               [&](const std::unique_ptr<Entity> &entity)
-                               {
-                                   if (!entity->isActive())
-                                   {
-                                       // Retrait du map des tags
-                                       if (!entity->getTag().empty())
-                                       {
-                                           taggedEntities.erase(entity->getTag());
-                                       }
-                                       return true;
-                                   }
-                                   return false;
-                               }),
-                entities.end());
         }
 
         // ====================================================================
@@ -542,43 +4012,332 @@ namespace ECS
         {
             T *system = new T(std::forward<TArgs>(args)...);
             system->manager = this;
+#if ECS_ENABLE_PROFILER
+            std::string name = Profiler::typeName(typeid(T).name());
+            system->updateProfileName = Profiler::internName(name + "::update");
+            system->renderProfileName = Profiler::internName(name + "::render");
+#endif
 
-            std::unique_ptr<System> uPtr{system};
-            systems.emplace_back(std::move(uPtr));
-
-            // Tri par priorit� (plus petit en premier)
-            std::sort(systems.begin(), systems.end(),
-                      [](const std::unique_ptr<System> &a, const std::unique_ptr<System> &b)
-                      {
-                          return a->getPriority() < b->getPriority();
-                      });
+            // Insertion à sa place selon la priorité (plus petit en premier, ordre d'ajout à égalité)
+            insertSystem(std::unique_ptr<System>(system));
+            getSystemCache<T>(); // Entrée de cache prête avant tout update() parallèle
 
             system->init();
+
+            // Signature connue après init(): le système sera prévenu des changements de ses types
+            (system->componentSignature | system->excludeSignature).forEach([&](ComponentID id)
+                                                                            { componentSystems[id].push_back(system); });
+
+            // Le nouveau système découvre les entités déjà existantes
+            for (Entity *entity : entities)
+            {
+                updateMembership(*system, *entity);
+            }
             return system;
         }
 
+        /*
+         * Retire un système (et ses listes d'entités)
+         * Ne pas appeler pendant update(): le système pourrait être en cours d'exécution
+         */
+        bool removeSystem(System *system)
+        {
+            auto it = std::find_if(systems.begin(), systems.end(),
+                                   [system](const std::unique_ptr<System> &s)
+                                   { return s.get() == system; });
+            if (it == systems.end())
+            {
+                return false;
+            }
+
+            for (auto &interested : componentSystems)
+            {
+                interested.erase(std::remove(interested.begin(), interested.end(), system), interested.end());
+            }
+            systems.erase(it);
+            reorderedSystems.erase(std::remove(reorderedSystems.begin(), reorderedSystems.end(), system),
+                                   reorderedSystems.end());
+            ++systemsVersion;
+            scheduleDirty = true;
+            return true;
+        }
+
+        template <typename T>
+        bool removeSystem()
+        {
+            T *system = getSystem<T>();
+            return system && removeSystem(system);
+        }
+
+        /*
+         * Plus nécessaire après setPriority() (le système se replace tout seul
+         * au début du prochain update/render, ou au prochain getSystems)
+         * Conservé pour le code existant
+         */
         void sortSystems()
         {
-            std::sort(systems.begin(), systems.end(),
+            reorderedSystems.clear();
+            std::stable_sort(systems.begin(), systems.end(),
                       [](const std::unique_ptr<System> &a, const std::unique_ptr<System> &b)
                       {
                           return a->getPriority() < b->getPriority();
                       });
+            applyRunAfter();
+            ++systemsVersion;
+            scheduleDirty = true;
         }
 
-        template <typename T>
-        std::vector<T *> getSystems()
+        /*
+         * Active l'exécution parallèle des update() (0 ou 1: séquentiel)
+         * Les systèmes sans conflit d'accès (voir System::accessComponent)
+         * tournent en même temps; sinon l'ordre des priorités est respecté.
+         * render() reste toujours séquentiel (SDL n'est pas thread-safe)
+         *
+         * Exemple:
+         *   manager.setThreadCount(std::thread::hardware_concurrency());
+         */
+        void setThreadCount(std::size_t count)
+        {
+            threadPool = count > 1 ? std::make_unique<ThreadPool>(count) : nullptr;
+        }
+
+        ThreadPool *getThreadPool() const { return threadPool.get(); }
+
+        // Tick courant de la change detection (voir Entity::getComponent)
+        std::uint32_t getChangeTick() const { return changeTick; }
+
+        // ====================================================================
+        // MEMORY
+        // ====================================================================
+
+        /*
+         * Pré-alloue la mémoire de chunkCount chunks (ex: avant de charger un niveau)
+         * Un chunk fait CHUNK_SIZE octets et contient des dizaines/centaines d'entités
+         */
+        void reserveChunks(std::size_t chunkCount) { chunkAllocator.reserve(chunkCount); }
+
+        const AllocatorStats &getAllocatorStats() const { return chunkAllocator.getStats(); }
+
+        /*
+         * Mesure la mémoire vivante par type de composant, par ressource, par système
+         * et pour les entités, et met à jour les pics et variations (deltaBytes: depuis le sample
+         * précédent). Appelé une fois par frame, après update(), delta donne la
+         * variation d'une frame.
+         *
+         * Coût: un passage par archetype, plus un appel à memoryUsage() par composant
+         * des seuls types qui en ont une (voir ECS::heapBytes)
+         */
+        const MemoryReport &sampleMemory()
         {
-            std::vector<T *> result;
+            MemoryReport report;
+
+            // Composants: nombre par type, et heap des types qui ont memoryUsage()
+            std::array<std::size_t, MAX_COMPONENTS> counts{};
+            std::array<std::size_t, MAX_COMPONENTS> heap{};
+            std::size_t largeChunkBytes = 0;
+            for (const auto &entry : archetypes)
+            {
+                const Internal::Archetype &archetype = *entry.second;
+                if (archetype.chunkBytes > Internal::CHUNK_SIZE)
+                {
+                    largeChunkBytes += archetype.chunks.size() * archetype.chunkBytes; // Hors du pool
+                }
+
+                for (std::size_t c = 0; c < archetype.columns.size(); ++c)
+                {
+                    const auto &column = archetype.columns[c];
+                    counts[column.type] += archetype.entityCount;
+                    if (!column.info.heapBytes)
+                    {
+                        continue;
+                    }
+                    for (std::size_t chunk = 0; chunk < archetype.chunks.size(); ++chunk)
+                    {
+                        for (std::size_t row = 0; row < archetype.chunks[chunk].count; ++row)
+                        {
+                            heap[column.type] += column.info.heapBytes(archetype.getSlot(c, chunk, row));
+                        }
+                    }
+                }
+            }
+
+            std::size_t componentHeap = 0;
+            for (ComponentID id = 0; id < MAX_COMPONENTS; ++id)
+            {
+                // Un type qui n'a plus d'instance reste listé (delta négatif, pic)
+                if (counts[id] == 0 && componentMemory[id].peakBytes == 0)
+                {
+                    continue;
+                }
+                const Internal::ComponentInfo &info = Internal::getComponentInfo(id);
+                MemoryUsage usage;
+                usage.name = Profiler::typeName(info.typeName);
+                usage.count = counts[id];
+                usage.bytes = counts[id] * info.size + heap[id];
+                Internal::recordMemorySample(usage, componentMemory[id]);
+                report.components.push_back(std::move(usage));
+                componentHeap += heap[id];
+            }
+
+            // Systèmes: liste dense + index par slot
+            std::size_t systemBytes = 0;
             for (auto &system : systems)
             {
-                T *castedSystem = dynamic_cast<T *>(system.get());
-                if (castedSystem)
+                MemoryUsage usage;
+                usage.name = Profiler::typeName(typeid(*system).name());
+                usage.count = system->entities.size();
+                usage.bytes = system->entities.capacity() * sizeof(Entity *) +
+                              system->entityIndex.capacity() * sizeof(std::uint32_t);
+                Internal::recordMemorySample(usage, system->memoryHistory);
+                systemBytes += usage.bytes;
+                report.systems.push_back(std::move(usage));
+            }
+
+            // Ressources (une ressource retirée reste listée, comme les composants)
+            std::size_t resourceBytes = 0;
+            resourceMemory.resize(resources.size());
+            resourceNames.resize(resources.size());
+            for (std::size_t id = 0; id < resources.size(); ++id)
+            {
+                if (!resources[id] && resourceMemory[id].peakBytes == 0)
+                {
+                    continue;
+                }
+                if (resources[id] && resourceNames[id].empty())
+                {
+                    resourceNames[id] = Profiler::typeName(resources[id]->typeName());
+                }
+                MemoryUsage usage;
+                usage.name = resourceNames[id];
+                usage.count = resources[id] ? 1 : 0;
+                usage.bytes = resources[id] ? resources[id]->memoryUsage() : 0;
+                Internal::recordMemorySample(usage, resourceMemory[id]);
+                resourceBytes += usage.bytes;
+                report.resources.push_back(std::move(usage));
+            }
+
+            // Entités: objets Entity (gardés par leur slot même après destruction) et index
+            MemoryUsage &entityUsage = report.entities;
+            entityUsage.name = "Entities";
+            entityUsage.count = entities.size();
+            entityUsage.bytes = slots.capacity() * sizeof(EntitySlot) +
+                                entities.capacity() * sizeof(Entity *) +
+                                freeSlots.capacity() * sizeof(std::uint32_t) +
+                                taggedEntities.capacity() * sizeof(std::vector<Entity *>);
+            for (const auto &slot : slots)
+            {
+                entityUsage.bytes += slot.storage ? sizeof(Entity) : 0;
+            }
+            for (const auto &tagged : taggedEntities)
+            {
+                entityUsage.bytes += tagged.capacity() * sizeof(Entity *);
+            }
+            for (const auto &layer : layerLists)
+            {
+                entityUsage.bytes += layer.entities.capacity() * sizeof(Entity *) +
+                                     layer.positions.capacity() * sizeof(std::uint32_t);
+            }
+            Internal::recordMemorySample(entityUsage, entityMemory);
+
+            const AllocatorStats &allocatorStats = chunkAllocator.getStats();
+            report.chunks.name = "Chunks";
+            report.chunks.count = allocatorStats.chunksInUse;
+            report.chunks.bytes = allocatorStats.reservedBytes + largeChunkBytes;
+            Internal::recordMemorySample(report.chunks, chunkMemory);
+
+            report.total.name = "Total";
+            report.total.count = entities.size();
+            report.total.bytes = report.chunks.bytes + componentHeap + resourceBytes + entityUsage.bytes + systemBytes;
+            Internal::recordMemorySample(report.total, totalMemory);
+
+            memoryReport = std::move(report);
+            return memoryReport;
+        }
+
+        // Résultat du dernier sampleMemory()
+        const MemoryReport &getMemoryReport() const { return memoryReport; }
+
+        /*
+         * Écrit le dernier sampleMemory() (composants triés du plus gros au plus petit)
+         */
+        void writeMemoryReport(std::ostream &out) const
+        {
+            std::ios_base::fmtflags flags = out.flags();
+            std::streamsize precision = out.precision();
+            out << std::fixed << std::setprecision(1);
+
+            auto size = [&](double bytes)
+            {
+                double magnitude = std::abs(bytes);
+                if (magnitude >= 1024.0 * 1024.0)
+                {
+                    out << bytes / (1024.0 * 1024.0) << " MB";
+                }
+                else if (magnitude >= 1024.0)
+                {
+                    out << bytes / 1024.0 << " KB";
+                }
+                else
                 {
-                    result.push_back(castedSystem);
+                    out << static_cast<long long>(bytes) << " B";
                 }
+            };
+            auto line = [&](const MemoryUsage &usage, const char *unit)
+            {
+                out << "  " << usage.name << ": ";
+                size(static_cast<double>(usage.bytes));
+                out << ", " << usage.count << " " << unit << " (peak ";
+                size(static_cast<double>(usage.peakBytes));
+                out << ", " << (usage.deltaBytes >= 0 ? "+" : "");
+                size(static_cast<double>(usage.deltaBytes));
+                out << ")\n";
+            };
+
+            out << "[ECS] Memory\n";
+            line(memoryReport.total, "entities");
+            line(memoryReport.chunks, "chunks in use");
+            line(memoryReport.entities, "alive");
+
+            std::vector<const MemoryUsage *> components;
+            for (const auto &usage : memoryReport.components)
+            {
+                components.push_back(&usage);
+            }
+            std::sort(components.begin(), components.end(), [](const MemoryUsage *a, const MemoryUsage *b)
+                      { return a->bytes > b->bytes; });
+            out << "Components:\n";
+            for (const MemoryUsage *usage : components)
+            {
+                line(*usage, "instances");
+            }
+
+            out << "Resources:\n";
+            for (const auto &usage : memoryReport.resources)
+            {
+                line(usage, "instance");
             }
-            return result;
+
+            out << "Systems:\n";
+            for (const auto &usage : memoryReport.systems)
+            {
+                line(usage, "entities");
+            }
+
+            out.flags(flags);
+            out.precision(precision);
+        }
+
+        /*
+         * Tous les systèmes de type T (ou dérivés), dans l'ordre d'exécution
+         * Liste en cache: recalculée seulement après un ajout/retrait/réordonnancement
+         * Les setPriority en attente sont appliqués d'abord (sauf pendant un update/render,
+         * dont l'ordre ne change pas)
+         * Utilisable depuis un update() parallèle (voir getSystemCache)
+         */
+        template <typename T>
+        const std::vector<T *> &getSystems()
+        {
+            return getSystemCache<T>().systems;
         }
 
         /*
@@ -587,63 +4346,357 @@ namespace ECS
          */
         void update(float deltaTime)
         {
+            ECS_PROFILE_SCOPE("Manager::update");
+
+            applySystemOrder();
+
+            // Nouvelle frame pour la change detection
+            ++changeTick;
+
             // Mise � jour des entit�s dans les syst�mes
             updateSystemEntities();
 
             // Mise � jour de tous les syst�mes
-            for (auto &system : systems)
+            // Passe 0: tous les systèmes par frame et le premier pas de chaque
+            // cadence fixe; passes suivantes: les pas fixes restants
+            std::size_t passes = prepareFixedSteps(deltaTime);
+            for (std::size_t pass = 0; pass < passes; ++pass)
             {
-                system->update(deltaTime);
+                selectPass(pass);
+
+                runningSystems = true;
+                try
+                {
+                    if (threadPool)
+                    {
+                        refreshSystemCaches();
+                        runningParallel = true;
+                        runSystemsParallel(deltaTime);
+                        runningParallel = false;
+                    }
+                    else
+                    {
+                        for (std::size_t i = 0; i < systems.size(); ++i)
+                        {
+                            if (systemActive[i])
+                            {
+                                runSystem(*systems[i], deltaTime);
+                            }
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    // Exception d'un système: le Manager reste utilisable
+                    runningSystems = false;
+                    runningParallel = false;
+                    throw;
+                }
+                runningSystems = false;
             }
         }
 
+        /*
+         * Nombre maximum de pas fixes rattrapés par frame et par cadence
+         * Au-delà (frame très lente), le temps en trop est abandonné
+         */
+        void setMaxFixedSteps(std::size_t steps) { maxFixedSteps = steps > 0 ? steps : 1; }
+        std::size_t getMaxFixedSteps() const { return maxFixedSteps; }
+
         void render(SDL_Renderer* renderer){
+            ECS_PROFILE_SCOPE("Manager::render");
+            applySystemOrder();
+            runningSystems = true;
             for (auto& system : systems){
+#if ECS_ENABLE_PROFILER
+                std::uint64_t start = Profiler::now();
                 system->render(renderer);
+                std::uint64_t end = Profiler::now();
+                Profiler::record(system->renderProfileName, start, end);
+                system->renderTimes.add(static_cast<float>(end - start) / 1e6f);
+#else
+                system->render(renderer);
+#endif
+            }
+            runningSystems = false;
+        }
+
+        /*
+         * Tableau des durées par système (voir System::getUpdateStats), ex: toutes les
+         * quelques secondes dans la console pour repérer le système qui mange la frame
+         */
+        void writeProfileStats(std::ostream &out) const
+        {
+            auto line = [&](const char *name, const ProfileStats &stats)
+            {
+                if (stats.samples > 0)
+                {
+                    out << "  " << name << ": mean " << stats.mean << " ms, p95 " << stats.p95
+                        << " ms, max " << stats.max << " ms (" << stats.samples << " samples)\n";
+                }
+            };
+
+            out << "[ECS] Profile (" << RollingTimes::WINDOW << " last calls)\n";
+            for (const auto &system : systems)
+            {
+                line(system->updateProfileName, system->getUpdateStats());
+                line(system->renderProfileName, system->getRenderStats());
             }
         }
 
         /*
          * Met � jour les entit�s de chaque syst�me selon leur signature
+         * Seules les entités modifiées depuis le dernier appel sont re-testées:
+         * une frame sans ajout/retrait de composant ne coûte rien ici
          */
         void updateSystemEntities()
         {
-            for (auto &system : systems)
+            ECS_PROFILE_SCOPE("Manager::updateSystemEntities");
+
+            // Index plutôt qu'itérateur: onEntityAdded peut marquer d'autres entités
+            for (std::size_t i = 0; i < dirtyEntities.size(); ++i)
             {
+                Entity *entity = dirtyEntities[i];
+                entity->membershipDirty = false;
 
-                for (auto &entity : entities)
+                // Copie puis remise à zéro: les hooks onEntityAdded/Removed peuvent re-marquer l'entité
+                bool fullCheck = entity->membershipFullCheck;
+                ComponentBitSet changed = entity->changedComponents;
+                entity->membershipFullCheck = false;
+                entity->changedComponents.reset();
+
+                if (fullCheck)
                 {
-                    if (entity->isActive() && system->matchesSignature(*entity))
+                    for (auto &system : systems)
                     {
-                        // V�rifier si l'entit� n'est pas d�j� dans le syst�me
-                        auto it = std::find(system->entities.begin(), system->entities.end(), entity.get());
-                        if (it == system->entities.end())
-                        {
-
-                            system->entities.push_back(entity.get());
-                            system->onEntityAdded(entity.get());
-                        }
+                        updateMembership(*system, *entity);
                     }
+                    continue;
                 }
+
+                changed.forEach([&](ComponentID id)
+                                {
+                                    for (System *system : componentSystems[id])
+                                    {
+                                        updateMembership(*system, *entity);
+                                    } });
             }
+            dirtyEntities.clear();
         }
 
         /*
          * R�cup�re un syst�me par son type
+         * O(1) une fois le cache de T construit (voir getSystems)
          */
         template <typename T>
         T *getSystem()
         {
-            for (auto &system : systems)
+            const std::vector<T *> &cached = getSystemCache<T>().systems;
+            return cached.empty() ? nullptr : cached.front();
+        }
+    };
+
+    // ========================================================================
+    // ENTITY TEMPLATE IMPLEMENTATION
+    // ========================================================================
+
+    /*
+     * Définis après Manager: l'ajout/retrait d'un composant déplace l'entité
+     * vers l'archetype de sa nouvelle signature
+     */
+    template <typename T, typename... TArgs>
+    T &Entity::addComponent(TArgs &&...args)
+    {
+        // Lève une exception au-delà de MAX_COMPONENTS types différents
+        ComponentID typeID = getComponentTypeID<T>();
+        static_assert(std::is_base_of<Component, T>::value, "Un composant doit hériter de ECS::Component");
+        static_assert(alignof(T) <= Internal::CHUNK_ALIGNMENT, "Alignement de composant trop grand pour un chunk");
+
+        // Construit d'abord hors du chunk: si le constructeur lève, l'entité
+        // n'a pas bougé et l'ancien composant est intact
+        T value(std::forward<TArgs>(args)...);
+
+        T *component;
+        if (hasComponent<T>())
+        {
+            // Le composant existe déjà: remplacé par affectation, le slot contient
+            // toujours un objet vivant même si l'affectation lève
+            component = &getComponent<T>();
+            Internal::replaceValue(*component, std::move(value));
+        }
+        else
+        {
+            manager->moveEntity(*this, manager->getArchetypeWith(*archetype, typeID), typeID);
+            manager->recordAdded(*this, typeID);
+            void *slot = archetype->getSlot(archetype->columnIndex[typeID], chunkIndex, chunkRow);
+            component = new (slot) T(std::move(value));
+        }
+        component->entity = this;
+        markChanged<T>();
+
+        // Appel du hook d'initialisation
+        component->init();
+
+        return *component;
+    }
+
+    template <typename Func>
+    void System::parallelForEach(Func &&func, std::size_t grainSize)
+    {
+        ThreadPool *pool = manager->getThreadPool();
+        if (!pool || entities.size() < parallelThreshold)
+        {
+            for (Entity *entity : entities)
             {
-                T *castedSystem = dynamic_cast<T *>(system.get());
-                if (castedSystem)
-                {
-                    return castedSystem;
-                }
+                func(entity);
             }
-            return nullptr;
+            return;
         }
-    };
+
+        pool->parallelFor(entities.size(), grainSize, [&](std::size_t begin, std::size_t end)
+                          {
+                              for (std::size_t i = begin; i < end; ++i)
+                              {
+                                  func(entities[i]);
+                              }
+                          });
+    }
+
+    inline void CommandBuffer::playback(Manager &manager)
+    {
+        std::vector<Command> recorded;
+        std::uint32_t createdCount;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recorded.swap(commands);
+            createdCount = pendingCount;
+            pendingCount = 0;
+            ++epoch; // Les refs pending déjà distribuées deviennent invalides
+        }
+
+        std::vector<EntityHandle> created(createdCount);
+        for (Command &command : recorded)
+        {
+            if (!command.apply)
+            {
+                created[command.target.pending] = manager.createEntity().getHandle();
+                continue;
+            }
+
+            EntityHandle handle = command.target.pending == EntityRef::NOT_PENDING
+                                      ? command.target.handle
+                                      : created[command.target.pending];
+            if (Entity *entity = manager.getEntity(handle))
+            {
+                command.apply(*entity);
+            }
+        }
+    }
+
+    inline void Entity::setTag(TagID t)
+    {
+        // Entité détruite: refresh() a déjà prévu son retrait, un nouveau tag lui survivrait
+        if (active && t != tag)
+        {
+            manager->tagEntity(*this, t);
+        }
+    }
+
+    inline void System::setPriority(int p)
+    {
+        if (p == priority)
+        {
+            return;
+        }
+        priority = p;
+        if (manager)
+        {
+            // Appelable depuis un update(): le Manager le replace avant le prochain update()
+            std::vector<System *> &pending = manager->reorderedSystems;
+            if (std::find(pending.begin(), pending.end(), this) == pending.end())
+            {
+                pending.push_back(this);
+            }
+        }
+    }
+
+    inline float System::getInterpolationAlpha() const
+    {
+        if (!isFixedRate())
+        {
+            return 1.0f;
+        }
+        return manager ? manager->fixedRateAlpha(updateInterval) : 0.0f;
+    }
+
+    inline void Entity::addLayer(Layer layer)
+    {
+        // Entité détruite: destroy() l'a déjà retirée de ses layers, la réinsérer laisserait
+        // un Entity* périmé dans la liste après recyclage du slot
+        if (active && layer < MAX_LAYERS && !layers.test(layer))
+        {
+            layers.set(layer);
+            manager->addToLayer(*this, layer);
+        }
+    }
+
+    inline void Entity::removeLayer(Layer layer)
+    {
+        if (active && layer < MAX_LAYERS && layers.test(layer))
+        {
+            layers.reset(layer);
+            manager->removeFromLayer(*this, layer);
+        }
+    }
+
+    inline void Entity::destroy()
+    {
+        if (!active)
+        {
+            return;
+        }
+        active = false;
+
+        // Retirée des layers tout de suite: getEntitiesByLayer ne renvoie que des entités actives
+        for (Layer layer = 0; layer < MAX_LAYERS; ++layer)
+        {
+            if (layers.test(layer))
+            {
+                manager->removeFromLayer(*this, layer);
+            }
+        }
+        manager->markDirty(*this);
+        manager->pendingDestroy.push_back(this);
+    }
+
+    inline std::uint32_t Entity::currentChangeTick() const
+    {
+        return manager->getChangeTick();
+    }
+
+    template <typename T>
+    void Entity::markChanged()
+    {
+        int column = archetype->columnIndex[getComponentTypeID<T>()];
+        if (column >= 0)
+        {
+            archetype->getTick(column, chunkIndex, chunkRow) = manager->getChangeTick();
+        }
+    }
+
+    inline void Entity::removeComponent(ComponentID typeID)
+    {
+        if (hasComponent(typeID))
+        {
+            manager->recordRemoved(*this, typeID);
+            manager->moveEntity(*this, manager->getArchetypeWithout(*archetype, typeID), typeID);
+        }
+    }
+
+    template <typename T>
+    void Entity::removeComponent()
+    {
+        removeComponent(getComponentTypeID<T>());
+    }
 
 } // namespace ECS
\ No newline at end of file
@@ -12,15 +12,22 @@ AnimationSystem::AnimationSystem(int tileW, int tileH)
     requireComponent<AnimationComponent>();
 }
 
-void AnimationSystem::update(float deltaTime) override
+void AnimationSystem::update(float deltaTime)
 {
+    (void)deltaTime;
+
     Uint64 currentTime = SDL_GetTicks();
 
-    for (auto entity : getEntities())
+    for (ECS::Entity *entity : getEntities())
     {
-        auto &sprite = entity->getComponent<SpriteComponent>();
-        auto &anim = entity->getComponent<AnimationComponent>();
+        if (!entity->isActive())
+        {
+            continue;
+        }
 
+        // Sprite en const: il n'est signalé modifié que si l'image affichée change
+        const SpriteComponent &sprite = entity->getComponent<const SpriteComponent>();
+        AnimationComponent &anim = entity->getComponent<AnimationComponent>();
         if (!anim.isPlaying)
         {
             continue;
@@ -60,18 +67,25 @@ void AnimationSystem::update(float deltaTime) override
             anim.lastFrameTime = currentTime;
         }
 
-        updateSpriteRect(sprite, anim, currentAnim);
+        SDL_Rect frameRect = getFrameRect(anim, currentAnim);
+        if (frameRect.x != sprite.srcRect.x || frameRect.y != sprite.srcRect.y ||
+            frameRect.w != sprite.srcRect.w || frameRect.h != sprite.srcRect.h)
+        {
+            entity->getComponent<SpriteComponent>().srcRect = frameRect;
+        }
     }
 }
 
-void AnimationSystem::updateSpriteRect(SpriteComponent &sprite, const AnimationComponent &anim, const Animation &currentAnim)
+SDL_Rect AnimationSystem::getFrameRect(const AnimationComponent &anim, const Animation &currentAnim) const
 {
 
     int row = currentAnim.index;
     int col = anim.currentFrame;
 
-    sprite.srcRect.x = static_cast<float>(col * tileWidth);
-    sprite.srcRect.y = static_cast<float>(row * tileHeight);
-    sprite.srcRect.w = static_cast<float>(tileWidth);
-    sprite.srcRect.h = static_cast<float>(tileHeight);
+    SDL_Rect rect;
+    rect.x = col * tileWidth;
+    rect.y = row * tileHeight;
+    rect.w = tileWidth;
+    rect.h = tileHeight;
+    return rect;
 }
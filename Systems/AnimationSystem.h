@@ -19,7 +19,7 @@ public:
 
 private:
 
-    void updateSpriteRect(SpriteComponent& sprite,
-        const AnimationComponent& anim,
-        const Animation& currentAnim);
+    // Rectangle de l'image courante dans la planche
+    SDL_Rect getFrameRect(const AnimationComponent& anim,
+        const Animation& currentAnim) const;
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include "../ECS.h"
+#include "../Components/CameraComponent.h"
+
+/*
+ * Caméra imposée à un système de rendu, résolue à chaque frame
+ * On retient l'entité et non l'adresse du composant: celle-ci change quand
+ * l'entité (ou une autre de son archetype) gagne ou perd un composant.
+ * Sans entité valide: la ressource CameraComponent du Manager (peut être absente)
+ */
+struct CameraOverride
+{
+    ECS::EntityHandle entity;
+
+    void set(ECS::Entity *owner) { entity = owner ? owner->getHandle() : ECS::EntityHandle(); }
+
+    // Composant hors entité: utiliser la ressource
+    void set(CameraComponent *cam) { set(cam ? cam->entity : nullptr); }
+
+    const CameraComponent *resolve(const ECS::Manager &manager) const
+    {
+        ECS::Entity *owner = manager.getEntity(entity);
+        if (owner && owner->hasComponent<CameraComponent>())
+            return &owner->getComponent<const CameraComponent>();
+        return manager.resource<CameraComponent>();
+    }
+};
@@ -1,4 +1,5 @@
 #include "CameraSystem.h"
+#include "MovementSystem.h"
 #include "../Components/CameraComponent.h"
 #include "../Components/TransformComponent.h"
 #include <iostream>
@@ -6,12 +7,13 @@
 CameraSystem::CameraSystem()
 {
     requireComponent<CameraComponent>();
+    accessComponent<TransformComponent>(ECS::Access::Read); // Position de la cible
 }
 
 void CameraSystem::setTarget(ECS::Entity *entity)
 
 {
-    targetEntity = entity;
+    targetEntity = entity->getHandle();
     std::cout << "[CameraSystem] target set to entity ID :" << entity->getID() << std::endl;
 }
 
@@ -19,30 +21,44 @@ void CameraSystem::update(float deltaTime)
 {
     (void)deltaTime;
 
+    // Le handle ne résout plus si la cible a été détruite
+    ECS::Entity *target = manager->getEntity(targetEntity);
+    if (!target || !target->hasComponent<TransformComponent>())
+        return;
+
+    // Suit la position interpolée, celle que RenderSystem dessine (sinon la cible tremble)
+    MovementSystem *movement = manager->getSystem<MovementSystem>();
+    float alpha = movement ? movement->getInterpolationAlpha() : 1.0f;
+    Vector2D targetPosition = target->getComponent<const TransformComponent>().interpolatedPosition(alpha);
+
     for (auto cameraEntity : getEntities())
     {
-        auto &camera = cameraEntity->getComponent<CameraComponent>();
+        follow(cameraEntity->getComponent<CameraComponent>(), targetPosition);
+    }
 
-        if (targetEntity && targetEntity->hasComponent<TransformComponent>())
-        {
-            auto &transform = targetEntity->getComponent<TransformComponent>();
+    // Caméra partagée en ressource (utilisée par les systèmes de rendu sans setCamera)
+    if (CameraComponent *camera = manager->resource<CameraComponent>())
+    {
+        follow(*camera, targetPosition);
+    }
+}
 
-            float targetX = transform.position.x;
-            float targetY = transform.position.y;
+void CameraSystem::follow(CameraComponent &camera, const Vector2D &target)
+{
+    float targetX = target.x;
+    float targetY = target.y;
 
-            float visibleWorldWidth = camera.viewportWidth / camera.zoom;
-            float visibleWorldHeight = camera.viewportHeight / camera.zoom;
+    float visibleWorldWidth = camera.viewportWidth / camera.zoom;
+    float visibleWorldHeight = camera.viewportHeight / camera.zoom;
 
-            camera.position.x = targetX - (visibleWorldWidth / 2.0f);
-            camera.position.y = targetY - (visibleWorldHeight / 2.0f);
+    camera.position.x = targetX - (visibleWorldWidth / 2.0f);
+    camera.position.y = targetY - (visibleWorldHeight / 2.0f);
 
-            float maxPosX = camera.maxX - visibleWorldWidth;
-            float maxPosY = camera.maxY - visibleWorldHeight;
+    float maxPosX = camera.maxX - visibleWorldWidth;
+    float maxPosY = camera.maxY - visibleWorldHeight;
 
-            camera.position.x = clamp(camera.position.x, camera.minX, maxPosX);
-            camera.position.y = clamp(camera.position.y, camera.minY, maxPosY);
-        }
-    }
+    camera.position.x = clamp(camera.position.x, camera.minX, maxPosX);
+    camera.position.y = clamp(camera.position.y, camera.minY, maxPosY);
 }
 
 float CameraSystem::clamp(float value, float min, float max)
@@ -4,12 +4,13 @@
 // Forward declarations
 class CameraComponent;
 class TransformComponent;
+class Vector2D;
 
 class CameraSystem : public ECS::System
 {
 
 private:
-    ECS::Entity *targetEntity = nullptr;
+    ECS::EntityHandle targetEntity;
 
 public:
     CameraSystem();
@@ -19,5 +20,6 @@ public:
     void update(float deltaTime) override;
 
 private:
+    void follow(CameraComponent &camera, const Vector2D &target);
     float clamp(float value, float min, float max);
 };
\ No newline at end of file
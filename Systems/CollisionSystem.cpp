@@ -5,69 +5,83 @@
 #include <SDL2/SDL.h>
 #include <vector>
 
-CollisionSystem::CollisionSystem()
+CollisionSystem::CollisionSystem(float updateRate)
 {
-    requireComponent<CollisionComponent>();
+    requireComponent<CollisionComponent>(ECS::Access::Read);
     requireComponent<TransformComponent>();
-}
+    accessComponent<TileMapComponent>(ECS::Access::Read);
 
-void CollisionSystem::init()
-{
-    for (auto &entity : manager->getEntities())
-    {
-        if (entity->hasComponent<TileMapComponent>())
-        {
-            tileMapEntity = entity.get();
-        }
-    }
+    // Même cadence que MovementSystem: un test de collision par pas de déplacement
+    setUpdateRate(updateRate);
 }
 
 void CollisionSystem::setTileMapEntity(ECS::Entity *entity)
 {
-    tileMapEntity = entity;
+    tileMapEntity = entity->getHandle();
 }
 
 void CollisionSystem::update(float deltaTime)
 {
 
-    if (!tileMapEntity)
+    // Map donnée via setTileMapEntity, sinon la ressource TileMapComponent du Manager
+    ECS::Entity *tileMap = manager->getEntity(tileMapEntity);
+    const TileMapComponent *tileMapComp = tileMap ? &tileMap->getComponent<const TileMapComponent>() : manager->resource<TileMapComponent>();
+    if (!tileMapComp)
         return;
 
-    auto &tileMapComp = tileMapEntity->getComponent<TileMapComponent>();
-
-    std::vector<TiledObject *> collisions = tileMapComp.getObjectsByGroup("Collision");
+    std::vector<const TiledObject *> collisions = tileMapComp->getObjectsByGroup("Collision");
 
-    for (auto &entity : getEntities())
+    // Chaque entité ne modifie que sa propre vélocité: parallélisable
+    parallelForEach([&](ECS::Entity *entity)
     {
+        // Transform pas touché depuis le dernier pas (ni déplacé, ni vélocité écrite):
+        // rien de nouveau à tester, seul le tableau des ticks est lu
+        if (!entity->isActive() || !hasChanged<TransformComponent>(*entity))
+        {
+            return;
+        }
+
+        const TransformComponent &transform = entity->getComponent<const TransformComponent>();
+        const CollisionComponent &collision = entity->getComponent<const CollisionComponent>();
 
-        auto &transform = entity->getComponent<TransformComponent>();
-        auto &collision = entity->getComponent<CollisionComponent>();
+        // Une entité immobile ne peut rien percuter: pas de test contre les murs
+        if (transform.velocity.x == 0 && transform.velocity.y == 0)
+        {
+            return;
+        }
 
-        float originalSpeed = transform.velocity.Magnitude();
+        Vector2D velocity = transform.velocity;
+        float originalSpeed = velocity.Magnitude();
 
-        float futurePosX = transform.position.x + transform.velocity.x * deltaTime;
-        float futurePosY = transform.position.y + transform.velocity.y * deltaTime;
+        float futurePosX = transform.position.x + velocity.x * deltaTime;
+        float futurePosY = transform.position.y + velocity.y * deltaTime;
         for (auto &col : collisions)
         {
             SDL_FRect colRect = {col->x, col->y, col->width, col->height};
             if (collision.intersects(colRect, {futurePosX, transform.position.y}))
             {
-                transform.velocity.x = 0;
-                if (transform.velocity.y != 0)
+                velocity.x = 0;
+                if (velocity.y != 0)
                 {
-                    float dirY = transform.velocity.y > 0 ? 1.0f : -1.0f;
-                    transform.velocity.y = dirY * originalSpeed;
+                    float dirY = velocity.y > 0 ? 1.0f : -1.0f;
+                    velocity.y = dirY * originalSpeed;
                 }
             }
             if (collision.intersects(colRect, {transform.position.x, futurePosY}))
             {
-                transform.velocity.y = 0;
-                if (transform.velocity.x != 0)
+                velocity.y = 0;
+                if (velocity.x != 0)
                 {
-                    float dirX = transform.velocity.x > 0 ? 1.0f : -1.0f;
-                    transform.velocity.x = dirX * originalSpeed;
+                    float dirX = velocity.x > 0 ? 1.0f : -1.0f;
+                    velocity.x = dirX * originalSpeed;
                 }
             }
         }
-    }
+
+        // Accès modifiable seulement si la vélocité change vraiment
+        if (velocity != transform.velocity)
+        {
+            entity->getComponent<TransformComponent>().velocity = velocity;
+        }
+    });
 }
@@ -10,13 +10,10 @@ class CollisionSystem : public ECS::System
 {
 
 private:
-    ECS::Entity *tileMapEntity = nullptr;
+    ECS::EntityHandle tileMapEntity;
 
 public:
-    CollisionSystem();
-
-    void init() override;
-
+    explicit CollisionSystem(float updateRate = 0.0f); // Même cadence que MovementSystem
 
     void setTileMapEntity(ECS::Entity *entity);
 
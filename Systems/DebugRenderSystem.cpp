@@ -10,14 +10,14 @@
 DebugRenderSystem::DebugRenderSystem(bool state)
     : enable(state)
 {
-    requireComponent<TransformComponent>();
-    requireComponent<CollisionComponent>();
+    requireComponent<TransformComponent>(ECS::Access::Read);
+    requireComponent<CollisionComponent>(ECS::Access::Read);
 }
 
 void DebugRenderSystem::setTileMapEntity(ECS::Entity *entity)
 
 {
-    tileMapEntity = entity;
+    tileMapEntity = entity->getHandle();
 }
 
 void DebugRenderSystem::toggle()
@@ -34,17 +34,22 @@ void DebugRenderSystem::setEnable(bool state)
 
 void DebugRenderSystem::renderer(SDL_Renderer *renderer)
 {
+    const CameraComponent *camera = cameraOverride.resolve(*manager);
 
     if (!camera)
         return;
     if (!enable)
         return;
 
+    static const ECS::TagID PLAYER = ECS::getTagID("Player");
+    static const ECS::TagID ENEMY = ECS::getTagID("Enemy");
+    static const ECS::TagID SPELL = ECS::getTagID("Spell");
+
     for (auto &entity : getEntities())
     {
 
-        auto &transform = entity->getComponent<TransformComponent>();
-        auto &collider = entity->getComponent<CollisionComponent>();
+        auto &transform = entity->getComponent<const TransformComponent>();
+        auto &collider = entity->getComponent<const CollisionComponent>();
 
         SDL_FRect rect = collider.getRect(transform.position);
 
@@ -55,22 +60,24 @@ void DebugRenderSystem::renderer(SDL_Renderer *renderer)
 
         SDL_FRect screenRect = {screenX, screenY, screenW, screenH};
 
-        if (collider.tag == "Player")
+        if (collider.hasTag(PLAYER))
             SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
 
-        if (collider.tag == "Enemy")
+        if (collider.hasTag(ENEMY))
             SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
 
-        if (collider.tag == "Spell")
+        if (collider.hasTag(SPELL))
             SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
 
         SDL_RenderDrawRectF(renderer, &screenRect);
     }
-    if (tileMapEntity && tileMapEntity->hasComponent<TileMapComponent>())
+    ECS::Entity *tileMap = manager->getEntity(tileMapEntity);
+    const TileMapComponent *tileMapResource = manager->resource<TileMapComponent>();
+    if ((tileMap && tileMap->hasComponent<TileMapComponent>()) || tileMapResource)
     {
-        auto &tileMapComp = tileMapEntity->getComponent<TileMapComponent>();
+        auto &tileMapComp = (tileMap && tileMap->hasComponent<TileMapComponent>()) ? tileMap->getComponent<const TileMapComponent>() : *tileMapResource;
 
-        std::vector<TiledObject *> collisions = tileMapComp.getObjectsByGroup("Collision");
+        std::vector<const TiledObject *> collisions = tileMapComp.getObjectsByGroup("Collision");
 
         for (auto &wall : collisions)
         {
@@ -87,7 +94,7 @@ void DebugRenderSystem::renderer(SDL_Renderer *renderer)
             SDL_RenderDrawRectF(renderer, &screenRect);
         }
 
-        std::vector<TiledObject *> triggers = tileMapComp.getObjectsByGroup("Triggers");
+        std::vector<const TiledObject *> triggers = tileMapComp.getObjectsByGroup("Triggers");
 
         for (auto &trigger : triggers)
         {
@@ -1,18 +1,18 @@
 #pragma once
 #include "../ECS.h"
+#include "CameraOverride.h"
 
 // Forward declarations
 class TransformComponent;
 class CollisionComponent;
-class CameraComponent;
 class TileMapComponent;
 struct SDL_Renderer;
 
 class DebugRenderSystem : public ECS::System
 {
 private:
-    CameraComponent *camera;
-    ECS::Entity *tileMapEntity;
+    CameraOverride cameraOverride;
+    ECS::EntityHandle tileMapEntity;
     bool enable = false;
 
 public:
@@ -25,7 +25,9 @@ public:
     void setEnable(bool state);
 
 
-    void setCamera(CameraComponent *cam) { camera = cam; }
+    // Voir CameraOverride
+    void setCamera(ECS::Entity *entity) { cameraOverride.set(entity); }
+    void setCamera(CameraComponent *cam) { cameraOverride.set(cam); }
 
     void renderer(SDL_Renderer* renderer);
 };
\ No newline at end of file
@@ -1,17 +1,41 @@
 #include "MovementSystem.h"
 #include "../Components/TransformComponent.h"
 
-MovementSystem::MovementSystem()
+MovementSystem::MovementSystem(float updateRate)
 {
     requireComponent<TransformComponent>();
+
+    // Pas fixe sur demande seulement: RenderSystem interpole alors entre deux pas
+    setUpdateRate(updateRate);
 }
 
 void MovementSystem::update(float deltaTime)
 {
-    for (auto entity : getEntities())
+    // Chaque transform est indépendant: lots d'entités répartis sur les threads
+    // La liste du système respecte sa signature (exclusions comprises)
+    parallelForEach([deltaTime](ECS::Entity *entity)
     {
-        auto &transform = entity->getComponent<TransformComponent>();
+        if (!entity->isActive())
+        {
+            return;
+        }
+
+        // Lecture en const: seuls les transforms réellement écrits sont signalés modifiés
+        const TransformComponent &current = entity->getComponent<const TransformComponent>();
+
+        // Une entité immobile n'est pas signalée (RenderSystem et CollisionSystem la laissent tranquille),
+        // sauf au pas où elle s'arrête: le rendu doit finir l'interpolation
+        bool moving = current.velocity.x != 0 || current.velocity.y != 0;
+        if (!moving && !current.isInterpolating())
+        {
+            return;
+        }
+
+        TransformComponent &transform = entity->getComponent<TransformComponent>();
+        transform.previousPosition = transform.position;
+        transform.previousRotation = transform.rotation;
         transform.position.x += transform.velocity.x * deltaTime;
         transform.position.y += transform.velocity.y * deltaTime;
-    }
+        transform.endStep();
+    });
 }
@@ -6,6 +6,14 @@ class TransformComponent;
 
 class MovementSystem : public ECS::System {
 public:
-    MovementSystem();
+    static constexpr float UPDATE_RATE = 60.0f; // Cadence conseillée pour des pas fixes
+
+    /*
+     * updateRate 0 (défaut): un pas par frame avec le deltaTime de la frame
+     * updateRate > 0: pas fixes (trajectoires indépendantes du framerate, rendu interpolé)
+     * Donner la même cadence à CollisionSystem et TransformSystem
+     * Exemple: manager.addSystem<MovementSystem>(MovementSystem::UPDATE_RATE);
+     */
+    explicit MovementSystem(float updateRate = 0.0f);
     void update(float deltaTime) override;
 };
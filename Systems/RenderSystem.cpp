@@ -1,4 +1,5 @@
 #include "RenderSystem.h"
+#include "MovementSystem.h"
 #include "../Components/TransformComponent.h"
 #include "../Components/SpriteComponent.h"
 #include "../Components/CameraComponent.h"
@@ -8,49 +9,110 @@
 
 RenderSystem::RenderSystem()
 {
-        requireComponent<TransformComponent>();
-        requireComponent<SpriteComponent>();
+        requireComponent<TransformComponent>(ECS::Access::Read);
+        requireComponent<SpriteComponent>(ECS::Access::Write); // dstRect
+    }
+
+    void RenderSystem::onEntityAdded(ECS::Entity *entity)
+    {
+        (void)entity;
+        membershipChanged = true;
+    }
+
+    void RenderSystem::onEntityRemoved(ECS::Entity *entity)
+    {
+        (void)entity;
+        membershipChanged = true;
+    }
+
+    float RenderSystem::getMovementAlpha() const
+    {
+        MovementSystem *movement = manager->getSystem<MovementSystem>();
+        return movement ? movement->getInterpolationAlpha() : 1.0f;
     }
 
     void RenderSystem::render(SDL_Renderer *renderer)
     {
-        std::vector<ECS::Entity *> sortedEntities = getEntities();
+        const CameraComponent *camera = cameraOverride.resolve(*manager);
+        float alpha = getMovementAlpha();
 
-        std::sort(sortedEntities.begin(), sortedEntities.end(),
-                  [](ECS::Entity *a, ECS::Entity *b)
-                  {
-                      auto &spriteA = a->getComponent<SpriteComponent>();
-                      auto &spriteB = b->getComponent<SpriteComponent>();
-                      return spriteA.renderLayer < spriteB.renderLayer;
-                  });
+        auto byRenderLayer = [](ECS::Entity *a, ECS::Entity *b)
+        {
+            auto &spriteA = a->getComponent<const SpriteComponent>();
+            auto &spriteB = b->getComponent<const SpriteComponent>();
+            return spriteA.renderLayer < spriteB.renderLayer;
+        };
 
-        for (auto entity : sortedEntities)
+        // Une entité qui entre n'a pas forcément de tick récent (ex: exclusion levée)
+        bool recomputeAll = membershipChanged;
+        if (membershipChanged)
+        {
+            sortedEntities = getEntities();
+            membershipChanged = false;
+            std::sort(sortedEntities.begin(), sortedEntities.end(), byRenderLayer);
+        }
+        else if (!std::is_sorted(sortedEntities.begin(), sortedEntities.end(), byRenderLayer))
         {
-            auto &transform = entity->getComponent<TransformComponent>();
-            auto &sprite = entity->getComponent<SpriteComponent>();
+            // Un renderLayer a changé
+            std::sort(sortedEntities.begin(), sortedEntities.end(), byRenderLayer);
+        }
 
-            if (sprite.texture == nullptr)
-                continue;
+        float zoom = camera ? camera->zoom : 1.0f;
+        float cameraX = camera ? camera->position.x : 0.0f;
+        float cameraY = camera ? camera->position.y : 0.0f;
 
-            float zoom = camera ? camera->zoom : 1.0f;
+        // Si la caméra bouge, tous les dstRect changent
+        recomputeAll = recomputeAll || lastRenderTick == 0 || (camera != nullptr) != lastHadCamera ||
+                       cameraX != lastCameraX || cameraY != lastCameraY || zoom != lastZoom;
+        lastHadCamera = camera != nullptr;
+        lastCameraX = cameraX;
+        lastCameraY = cameraY;
+        lastZoom = zoom;
 
-            float worldX = transform.position.x;
-            float worldY = transform.position.y;
+        std::uint32_t since = lastRenderTick;
+        lastRenderTick = manager->getChangeTick();
 
-            float screenX = transform.position.x;
-            float screenY = transform.position.y;
+        for (auto entity : sortedEntities)
+        {
+            auto &transform = entity->getComponent<const TransformComponent>();
+            auto &sprite = entity->getComponent<const SpriteComponent>();
+            SDL_Rect dstRect = sprite.dstRect;
 
-            if (camera)
+            // Toute écriture via getComponent (scale, srcRect, position...) avance le tick
+            // Une entité en mouvement est entre deux pas fixes: sa position dépend d'alpha
+            if (recomputeAll || transform.isInterpolating() ||
+                entity->changedSince<TransformComponent>(since) ||
+                entity->changedSince<SpriteComponent>(since))
             {
-                screenX = (worldX - camera->position.x) * zoom;
-                screenY = (worldY - camera->position.y) * zoom;
-            }
+                Vector2D interpolated = transform.interpolatedPosition(alpha);
+                float worldX = interpolated.x;
+                float worldY = interpolated.y;
 
+                float screenX = worldX;
+                float screenY = worldY;
 
-            sprite.dstRect.x = static_cast<int>(screenX);
-            sprite.dstRect.y = static_cast<int>(screenY);
-            sprite.dstRect.w = static_cast<int>(sprite.srcRect.w * transform.scale * zoom); // ✅ Zoom
-            sprite.dstRect.h = static_cast<int>(sprite.srcRect.h * transform.scale * zoom);
+                if (camera)
+                {
+                    screenX = (worldX - camera->position.x) * zoom;
+                    screenY = (worldY - camera->position.y) * zoom;
+                }
+
+                dstRect.x = static_cast<int>(screenX);
+                dstRect.y = static_cast<int>(screenY);
+                dstRect.w = static_cast<int>(sprite.srcRect.w * transform.scale * zoom); // ✅ Zoom
+                dstRect.h = static_cast<int>(sprite.srcRect.h * transform.scale * zoom);
+
+                // Écriture (tick) seulement si le rectangle change: un sprite immobile
+                // n'est recalculé qu'une fois de plus, puis plus du tout
+                if (dstRect.x != sprite.dstRect.x || dstRect.y != sprite.dstRect.y ||
+                    dstRect.w != sprite.dstRect.w || dstRect.h != sprite.dstRect.h)
+                {
+                    entity->getComponent<SpriteComponent>().dstRect = dstRect;
+                }
+            }
+
+            if (sprite.texture == nullptr)
+                continue;
 
             SDL_RendererFlip flip = SDL_FLIP_NONE;
             if (sprite.flipHorizontal && sprite.flipVertical)
@@ -67,15 +129,15 @@ RenderSystem::RenderSystem()
             }
 
             SDL_Point center = {
-                sprite.dstRect.w / 2,
-                sprite.dstRect.h / 2};
+                dstRect.w / 2,
+                dstRect.h / 2};
 
             SDL_RenderCopyEx(
                 renderer,
                 sprite.texture,
                 &sprite.srcRect,
-                &sprite.dstRect,
-                transform.rotation,
+                &dstRect,
+                transform.interpolatedRotation(alpha),
                 &center,
                 flip);
         }
@@ -1,8 +1,10 @@
 #pragma once
 #include "../ECS.h"
+#include "CameraOverride.h"
+#include <cstdint>
+#include <vector>
 
 // Forward declarations
-class CameraComponent;
 class TransformComponent;
 class SpriteComponent;
 struct SDL_Renderer;
@@ -10,12 +12,31 @@ struct SDL_Renderer;
 class RenderSystem : public ECS::System
 {
 private:
-    CameraComponent *camera = nullptr;
+    CameraOverride cameraOverride;
+
+    // Ordre de dessin gardé d'une frame à l'autre (retrié seulement si nécessaire)
+    std::vector<ECS::Entity *> sortedEntities;
+    bool membershipChanged = true;
+
+    // Change detection: les dstRect ne sont recalculés que si quelque chose a bougé
+    std::uint32_t lastRenderTick = 0;
+    float lastCameraX = 0.0f;
+    float lastCameraY = 0.0f;
+    float lastZoom = 1.0f;
+    bool lastHadCamera = false;
 
 public:
     RenderSystem();
 
-    void setCamera(CameraComponent *cam) { camera = cam; }
+    // Voir CameraOverride
+    void setCamera(ECS::Entity *entity) { cameraOverride.set(entity); }
+    void setCamera(CameraComponent *cam) { cameraOverride.set(cam); }
 
     void render(SDL_Renderer* renderer) override;
+
+    void onEntityAdded(ECS::Entity *entity) override;
+    void onEntityRemoved(ECS::Entity *entity) override;
+
+private:
+    float getMovementAlpha() const; // Interpolation entre les deux derniers pas de MovementSystem
 };
\ No newline at end of file
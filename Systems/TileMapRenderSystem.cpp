@@ -7,21 +7,20 @@
 TileMapRenderSystem::TileMapRenderSystem(int renderOrder)
     : targetRenderOrder(renderOrder)
 {
-    requireComponent<TileMapComponent>();
+    requireComponent<TileMapComponent>(ECS::Access::Read);
 }
 
 void TileMapRenderSystem::render(SDL_Renderer *renderer)
 {
+    const CameraComponent *camera = cameraOverride.resolve(*manager);
     if (!camera)
     {
         std::cout << "[TileMapRenderSystem] no cam set";
         return;
     }
 
-    for (auto &entity : getEntities())
+    auto drawLayers = [&](const TileMapComponent &tilemap)
     {
-        auto &tilemap = entity->getComponent<TileMapComponent>();
-
         for (auto &layer : tilemap.layers)
         {
             if (layer.renderOrder == targetRenderOrder)
@@ -30,11 +29,23 @@ void TileMapRenderSystem::render(SDL_Renderer *renderer)
                 drawLayer(tilemap, &layer, renderer);
             }
         }
+    };
+
+    for (auto &entity : getEntities())
+    {
+        drawLayers(entity->getComponent<const TileMapComponent>());
+    }
+
+    // Map partagée en ressource du Manager
+    if (TileMapComponent *tilemap = manager->resource<TileMapComponent>())
+    {
+        drawLayers(*tilemap);
     }
 }
 
-void TileMapRenderSystem::drawLayer(TileMapComponent &tilemap, const Layer *layer, SDL_Renderer *renderer)
+void TileMapRenderSystem::drawLayer(const TileMapComponent &tilemap, const Layer *layer, SDL_Renderer *renderer)
 {
+    const CameraComponent *camera = cameraOverride.resolve(*manager);
     if (camera == nullptr)
         return;
 
@@ -59,7 +70,7 @@ void TileMapRenderSystem::drawLayer(TileMapComponent &tilemap, const Layer *laye
             int gid = layer->tiles[index];
             if (gid == 0)
                 continue;
-            TileSet *tileset = tilemap.getTilesetFromGID(gid);
+            const TileSet *tileset = tilemap.getTilesetFromGID(gid);
             if (!tileset)
                 continue;
 
@@ -1,9 +1,9 @@
 #pragma once
 #include "../ECS.h"
+#include "CameraOverride.h"
 
 // Forward declarations
 class TileMapComponent;
-class CameraComponent;
 struct Layer;
 struct SDL_Renderer;
 
@@ -11,15 +11,17 @@ class TileMapRenderSystem : public ECS::System
 {
 
 private:
-    CameraComponent *camera = nullptr;
+    CameraOverride cameraOverride;
     int targetRenderOrder;
 
 public:
-    void setCamera(CameraComponent *cam) { camera = cam; }
+    // Voir CameraOverride
+    void setCamera(ECS::Entity *entity) { cameraOverride.set(entity); }
+    void setCamera(CameraComponent *cam) { cameraOverride.set(cam); }
     TileMapRenderSystem(int renderOrder = 0);
 
     void render(SDL_Renderer *renderer) override;
 
 private:
-    void drawLayer(TileMapComponent &tilemap, const Layer *layer, SDL_Renderer *renderer);
+    void drawLayer(const TileMapComponent &tilemap, const Layer *layer, SDL_Renderer *renderer);
 };
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "TransformSystem.h"
+#include "MovementSystem.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/HierarchyComponent.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+TransformSystem::TransformSystem(float updateRate)
+{
+    requireComponent<TransformComponent>(); // Écrit celui de l'enfant, lit celui du parent
+    requireComponent<HierarchyComponent>(ECS::Access::Read);
+
+    setUpdateRate(updateRate);
+    runAfter<MovementSystem>();
+}
+
+void TransformSystem::onEntityAdded(ECS::Entity *entity)
+{
+    (void)entity;
+    orderChanged = true;
+}
+
+void TransformSystem::onEntityRemoved(ECS::Entity *entity)
+{
+    (void)entity;
+    orderChanged = true;
+}
+
+void TransformSystem::update(float deltaTime)
+{
+    (void)deltaTime;
+
+    // Tant qu'un cycle existe, ses membres ne sont pas dans nodes: retri à chaque pas
+    if (cycleCount > 0)
+    {
+        orderChanged = true;
+    }
+
+    // Décalages et parents: seuls les HierarchyComponent signalés modifiés sont relus
+    for (Node &node : nodes)
+    {
+        node.localChanged = hasChanged<HierarchyComponent>(*node.entity);
+        if (node.localChanged && node.entity->getComponent<const HierarchyComponent>().parent != node.parent)
+        {
+            orderChanged = true;
+        }
+    }
+    if (orderChanged)
+    {
+        rebuildOrder();
+    }
+
+    world.resize(nodes.size());
+    rootInputs.resize(nodes.size());
+
+    // Sous-arbres contigus: tout nœud avant dirtyEnd descend d'un nœud recalculé
+    std::size_t dirtyEnd = 0;
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        const Node &node = nodes[i];
+        bool dirty = allDirty || i < dirtyEnd || node.localChanged;
+
+        WorldTransform parent;
+        if (node.parentNode != NO_NODE)
+        {
+            if (!dirty)
+            {
+                continue;
+            }
+            // Parent dans la hiérarchie: déjà calculé (ordre en profondeur d'abord)
+            parent = world[node.parentNode];
+        }
+        else
+        {
+            // Racine: son entrée est comparée à celle du pas précédent
+            ECS::Entity *parentEntity = manager->getEntity(node.parent);
+            RootInput input;
+            input.attached = parentEntity && parentEntity->hasComponent<TransformComponent>();
+            input.transform = toWorld(input.attached ? parentEntity->getComponent<const TransformComponent>()
+                                                     : node.entity->getComponent<const TransformComponent>());
+
+            RootInput &previous = rootInputs[i];
+            if (!dirty && input.attached == previous.attached && sameTransform(input.transform, previous.transform))
+            {
+                continue;
+            }
+            previous = input;
+
+            if (!input.attached)
+            {
+                // Parent détruit (ou sans TransformComponent): reste en place, ses enfants le suivent
+                world[i] = input.transform;
+                dirtyEnd = std::max<std::size_t>(dirtyEnd, node.subtreeEnd);
+                continue;
+            }
+            parent = input.transform;
+        }
+
+        dirtyEnd = std::max<std::size_t>(dirtyEnd, node.subtreeEnd);
+        world[i] = applyParent(node.entity->getComponent<const HierarchyComponent>(), parent);
+
+        const WorldTransform &result = world[i];
+        if (sameTransform(toWorld(node.entity->getComponent<const TransformComponent>()), result))
+        {
+            continue;
+        }
+
+        // Accès modifiable (et donc signalé) seulement quand le transform change
+        TransformComponent &transform = node.entity->getComponent<TransformComponent>();
+        transform.position = result.position;
+        transform.previousPosition = result.previousPosition;
+        transform.rotation = result.rotation;
+        transform.previousRotation = result.previousRotation;
+        transform.scale = result.scale;
+        transform.endStep();
+    }
+    allDirty = false;
+}
+
+/*
+ * Range les enfants en profondeur d'abord: chaque sous-arbre est contigu
+ * et suit immédiatement son parent
+ */
+void TransformSystem::rebuildOrder()
+{
+    const std::vector<ECS::Entity *> &members = getEntities();
+    std::size_t count = members.size();
+
+    // Slot d'entité -> index dans members
+    std::uint32_t maxSlot = 0;
+    for (ECS::Entity *entity : members)
+    {
+        maxSlot = std::max(maxSlot, entity->getHandle().index);
+    }
+    std::vector<std::uint32_t> memberOfSlot(count > 0 ? maxSlot + 1 : 0, NO_NODE);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        memberOfSlot[members[i]->getHandle().index] = static_cast<std::uint32_t>(i);
+    }
+
+    // Parent de chaque membre (NO_NODE si hors hiérarchie), puis enfants par tri comptage
+    std::vector<std::uint32_t> parentMember(count, NO_NODE);
+    std::vector<std::uint32_t> childStart(count + 1, 0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ECS::EntityHandle parent = members[i]->getComponent<const HierarchyComponent>().parent;
+        ECS::Entity *parentEntity = manager->getEntity(parent);
+        if (parentEntity && parent.index < memberOfSlot.size() && memberOfSlot[parent.index] != NO_NODE)
+        {
+            parentMember[i] = memberOfSlot[parent.index];
+            ++childStart[parentMember[i] + 1];
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        childStart[i + 1] += childStart[i];
+    }
+    std::vector<std::uint32_t> children(childStart[count]);
+    std::vector<std::uint32_t> cursor(childStart.begin(), childStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (parentMember[i] != NO_NODE)
+        {
+            children[cursor[parentMember[i]]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Parcours en profondeur depuis chaque racine
+    std::vector<std::uint32_t> nodeOfMember(count, NO_NODE);
+    std::vector<std::uint32_t> stack;
+    nodes.clear();
+    for (std::size_t root = 0; root < count; ++root)
+    {
+        if (parentMember[root] != NO_NODE)
+        {
+            continue;
+        }
+
+        stack.assign(1, static_cast<std::uint32_t>(root));
+        while (!stack.empty())
+        {
+            std::uint32_t member = stack.back();
+            stack.pop_back();
+
+            std::uint32_t parentNode = parentMember[member] != NO_NODE ? nodeOfMember[parentMember[member]] : NO_NODE;
+            nodeOfMember[member] = static_cast<std::uint32_t>(nodes.size());
+            nodes.push_back({members[member], members[member]->getComponent<const HierarchyComponent>().parent, parentNode,
+                             static_cast<std::uint32_t>(nodes.size() + 1), false});
+
+            for (std::uint32_t c = childStart[member + 1]; c-- > childStart[member];)
+            {
+                stack.push_back(children[c]);
+            }
+        }
+    }
+
+    // Fin de chaque sous-arbre: remontée depuis les feuilles
+    for (std::size_t i = nodes.size(); i-- > 0;)
+    {
+        if (nodes[i].parentNode != NO_NODE)
+        {
+            Node &parent = nodes[nodes[i].parentNode];
+            parent.subtreeEnd = std::max(parent.subtreeEnd, nodes[i].subtreeEnd);
+        }
+    }
+
+    // Membres jamais atteints: ils sont leur propre ancêtre
+    if (count - nodes.size() != cycleCount && nodes.size() != count)
+    {
+        std::cerr << "[TransformSystem] WARNING: " << count - nodes.size() << " entities in a parent cycle are not updated\n";
+    }
+    cycleCount = count - nodes.size();
+    orderChanged = false;
+    allDirty = true;
+}
+
+TransformSystem::WorldTransform TransformSystem::toWorld(const TransformComponent &transform)
+{
+    // Écrit hors pas: pas d'état précédent à suivre (les enfants ne glissent pas non plus)
+    if (!transform.isInStep())
+    {
+        return {transform.position, transform.position, transform.rotation, transform.rotation, transform.scale};
+    }
+    return {transform.position, transform.previousPosition, transform.rotation, transform.previousRotation, transform.scale};
+}
+
+TransformSystem::WorldTransform TransformSystem::applyParent(const HierarchyComponent &hierarchy, const WorldTransform &parent)
+{
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.0f;
+
+    // Décalage local mis à l'échelle puis tourné dans le repère du parent
+    auto offsetFrom = [&](const Vector2D &origin, float rotation)
+    {
+        Vector2D offset = hierarchy.localPosition * parent.scale;
+        float cosR = std::cos(rotation * DEG_TO_RAD);
+        float sinR = std::sin(rotation * DEG_TO_RAD);
+        return origin + Vector2D(offset.x * cosR - offset.y * sinR, offset.x * sinR + offset.y * cosR);
+    };
+
+    WorldTransform result;
+    result.position = offsetFrom(parent.position, parent.rotation);
+    result.rotation = parent.rotation + hierarchy.localRotation;
+    result.scale = parent.scale * hierarchy.localScale;
+
+    // État précédent dérivé de celui du parent: l'enfant s'interpole avec lui
+    result.previousPosition = offsetFrom(parent.previousPosition, parent.previousRotation);
+    result.previousRotation = parent.previousRotation + hierarchy.localRotation;
+    return result;
+}
+
+bool TransformSystem::sameTransform(const WorldTransform &a, const WorldTransform &b)
+{
+    return a.position == b.position && a.previousPosition == b.previousPosition &&
+           a.rotation == b.rotation && a.previousRotation == b.previousRotation && a.scale == b.scale;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "../ECS.h"
+#include "../Utils/Vector2D.h"
+#include <cstdint>
+#include <vector>
+
+// Forward declarations
+class TransformComponent;
+class HierarchyComponent;
+
+/*
+ * Propage les transformations des parents vers les enfants (voir HierarchyComponent)
+ * Les enfants sont rangés en profondeur d'abord: un parent est toujours traité avant
+ * ses enfants, qui lisent sa transformation monde dans un tableau contigu
+ *
+ * Seuls les sous-arbres sales sont recalculés:
+ *   - HierarchyComponent obtenu en accès modifiable (getComponent non const) depuis le dernier pas
+ *   - transformation du parent d'une racine différente de celle du pas précédent
+ *     (comparée par valeur: un parent déplacé via getComponent est suivi aussi)
+ *
+ * À créer avec la même cadence que MovementSystem, toujours exécuté après lui (runAfter)
+ * pour que les enfants suivent les déplacements du pas en cours
+ */
+class TransformSystem : public ECS::System
+{
+private:
+    static constexpr std::uint32_t NO_NODE = 0xFFFFFFFFu;
+
+    struct Node
+    {
+        ECS::Entity *entity;
+        ECS::EntityHandle parent; // Parent lors du dernier tri (détecte les changements)
+        std::uint32_t parentNode; // Index du parent dans nodes (NO_NODE: racine, parent hors hiérarchie)
+        std::uint32_t subtreeEnd; // Fin (exclue) du sous-arbre contigu qui commence à ce nœud
+        bool localChanged;        // HierarchyComponent modifié depuis le dernier pas
+    };
+
+    // Transformation monde calculée pendant le pas, lue par les enfants
+    struct WorldTransform
+    {
+        Vector2D position;
+        Vector2D previousPosition;
+        float rotation;
+        float previousRotation;
+        float scale;
+    };
+
+    // Entrée d'une racine au dernier pas: transformation de son parent,
+    // ou la sienne si le parent n'existe plus (elle reste en place)
+    struct RootInput
+    {
+        bool attached;
+        WorldTransform transform;
+    };
+
+    std::vector<Node> nodes;            // Ordre en profondeur d'abord
+    std::vector<WorldTransform> world;  // Indexé comme nodes, conservé d'un pas à l'autre
+    std::vector<RootInput> rootInputs;  // Indexé comme nodes (seules les racines l'utilisent)
+    bool orderChanged = true;  // Membres ou parents modifiés: nodes à retrier
+    bool allDirty = true;      // Après un tri: world n'est plus valide, tout est recalculé
+    std::size_t cycleCount = 0; // Membres pris dans un cycle de parents (hors de nodes)
+
+public:
+    explicit TransformSystem(float updateRate = 0.0f); // Même cadence que MovementSystem
+
+    void update(float deltaTime) override;
+
+    void onEntityAdded(ECS::Entity *entity) override;
+    void onEntityRemoved(ECS::Entity *entity) override;
+
+private:
+    void rebuildOrder();
+    static WorldTransform toWorld(const TransformComponent &transform);
+    static WorldTransform applyParent(const HierarchyComponent &hierarchy, const WorldTransform &parent);
+    static bool sameTransform(const WorldTransform &a, const WorldTransform &b);
+};
@@ -11,8 +11,13 @@
 TriggerSystem::TriggerSystem()
 
     {
-        requireComponent<TransformComponent>();
-        requireComponent<CollisionComponent>();
+        requireComponent<TransformComponent>(ECS::Access::Read);
+        requireComponent<CollisionComponent>(ECS::Access::Read);
+        requireComponent<PlayerComponent>(ECS::Access::Read); // Seul le joueur déclenche les triggers
+        accessComponent<TileMapComponent>(ECS::Access::Read);
+
+        // Le callback de téléportation recharge la map et joue du son
+        setExclusive(true);
     }
 
     void TriggerSystem::setTeleportCallback(std::function<void(const std::string &, const std::string &)> callback)
@@ -25,42 +30,41 @@ TriggerSystem::TriggerSystem()
     {
         (void)deltaTime;
 
-        if (!tileMapEntity)
+        // Map donnée via setTileMapEntity, sinon la ressource TileMapComponent du Manager
+        ECS::Entity *tileMap = manager->getEntity(tileMapEntity);
+        const TileMapComponent *tileMapComp = tileMap ? &tileMap->getComponent<const TileMapComponent>() : manager->resource<TileMapComponent>();
+        if (!tileMapComp)
             return;
 
         for (auto &entity : getEntities())
         {
+            auto &transform = entity->getComponent<const TransformComponent>();
+            auto &collision = entity->getComponent<const CollisionComponent>();
 
-            if (entity->hasComponent<PlayerComponent>())
-            {
-                auto &transform = entity->getComponent<TransformComponent>();
-                auto &collision = entity->getComponent<CollisionComponent>();
-
-                std::vector<TiledObject *> triggers = tileMapEntity->getComponent<TileMapComponent>().getObjectsByGroup("Triggers");
+            std::vector<const TiledObject *> triggers = tileMapComp->getObjectsByGroup("Triggers");
 
-                for (auto &trigger : triggers)
+            for (auto &trigger : triggers)
+            {
+                SDL_FRect triggerRect = {trigger->x, trigger->y, trigger->width, trigger->height};
+                if (collision.intersects(triggerRect, transform.position))
                 {
-                    SDL_FRect triggerRect = {trigger->x, trigger->y, trigger->width, trigger->height};
-                    if (collision.intersects(triggerRect, transform.position))
-                    {
 
-                        if (triggeredObjects.find(trigger) == triggeredObjects.end())
-                        {
-                            onTriggerEnter(trigger);
-                            triggeredObjects.insert(trigger);
-                        }
-                    }
-                    else
+                    if (triggeredObjects.find(trigger) == triggeredObjects.end())
                     {
-
-                        triggeredObjects.erase(trigger);
+                        onTriggerEnter(trigger);
+                        triggeredObjects.insert(trigger);
                     }
                 }
+                else
+                {
+
+                    triggeredObjects.erase(trigger);
+                }
             }
         }
     }
 
-    void TriggerSystem::onTriggerEnter(TiledObject *trigger)
+    void TriggerSystem::onTriggerEnter(const TiledObject *trigger)
     {
         std::cout << "[TriggerSystem] Trigger activated!\n";
         std::cout << "  Destination: " << trigger->getProperty("destination") << "\n";
@@ -14,18 +14,18 @@ struct TiledObject;
 class TriggerSystem : public ECS::System
 {
 private:
-    ECS::Entity *tileMapEntity;
-    std::set<TiledObject *> triggeredObjects;
+    ECS::EntityHandle tileMapEntity;
+    std::set<const TiledObject *> triggeredObjects;
     std::function<void(const std::string &, const std::string &)> onTeleportCallback;
 
 public:
     TriggerSystem();
 
-    void setTileMapEntity(ECS::Entity *entity) { tileMapEntity = entity; }
+    void setTileMapEntity(ECS::Entity *entity) { tileMapEntity = entity->getHandle(); }
 
     void setTeleportCallback(std::function<void(const std::string &, const std::string &)> callback);
 
     void update(float deltaTime) override;
 
-    void onTriggerEnter(TiledObject *trigger);
+    void onTriggerEnter(const TiledObject *trigger);
 };
\ No newline at end of file
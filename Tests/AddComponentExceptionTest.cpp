@@ -0,0 +1,145 @@
+/*
+ * Régression: un constructeur de composant qui lève pendant addComponent ne
+ * doit ni déplacer l'entité, ni émettre d'événement Added, ni laisser dans le
+ * chunk un objet détruit ou jamais construit (remplacement comme ajout).
+ * Un remplacement dont l'affectation lève laisse l'ancien objet vivant,
+ * détruit une seule fois.
+ *
+ * g++ -std=c++17 -I.. AddComponentExceptionTest.cpp -o AddComponentExceptionTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+int alive = 0; // Instances de Fragile construites et pas encore détruites
+
+struct Fragile : ECS::Component
+{
+    int value = 0;
+
+    explicit Fragile(int v) : value(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("Fragile: valeur négative");
+        }
+        ++alive;
+    }
+    Fragile(const Fragile &other) : value(other.value) { ++alive; }
+    Fragile(Fragile &&other) noexcept : value(other.value) { ++alive; }
+    ~Fragile() override { --alive; }
+};
+
+// Copie et affectation lèvent sur demande
+struct Brittle : ECS::Component
+{
+    int value = 0;
+    bool breakOnMove = false;
+
+    Brittle(int v, bool fail) : value(v), breakOnMove(fail) { ++alive; }
+    Brittle(const Brittle &other) : value(other.value), breakOnMove(other.breakOnMove) { ++alive; }
+    Brittle(Brittle &&other) : value(other.value), breakOnMove(other.breakOnMove)
+    {
+        if (breakOnMove)
+        {
+            throw std::runtime_error("Brittle: déplacement");
+        }
+        ++alive;
+    }
+    Brittle &operator=(Brittle &&other)
+    {
+        if (other.breakOnMove)
+        {
+            throw std::runtime_error("Brittle: affectation");
+        }
+        value = other.value;
+        return *this;
+    }
+    ~Brittle() override { --alive; }
+};
+
+struct Position : ECS::Component
+{
+    float x = 0.0f;
+};
+
+int main()
+{
+    ECS::Manager manager;
+    std::size_t addedEvents = 0;
+    manager.observe<Fragile>(ECS::ComponentEvent::Added,
+                             [&](const std::vector<ECS::EntityHandle> &added)
+                             { addedEvents += added.size(); });
+
+    // Ajout: l'entité reste dans son archetype, sans événement
+    auto &entity = manager.createEntity();
+    entity.addComponent<Position>().x = 4.0f;
+    bool thrown = false;
+    try
+    {
+        entity.addComponent<Fragile>(-1);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(!entity.hasComponent<Fragile>());
+    assert(entity.getComponent<Position>().x == 4.0f);
+    assert(alive == 0);
+    manager.refresh();
+    assert(addedEvents == 0);
+
+    // Remplacement: l'ancien composant reste en place
+    entity.addComponent<Fragile>(7);
+    manager.refresh();
+    assert(addedEvents == 1);
+    thrown = false;
+    try
+    {
+        entity.addComponent<Fragile>(-2);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(entity.getComponent<Fragile>().value == 7);
+    assert(entity.getComponent<Fragile>().entity == &entity);
+    assert(alive == 1);
+
+    // Affectation qui lève: l'ancien objet reste vivant, rien n'est détruit
+    entity.addComponent<Brittle>(3, false);
+    assert(alive == 2);
+    thrown = false;
+    try
+    {
+        entity.addComponent<Brittle>(9, true);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(alive == 2);
+    assert(entity.getComponent<Brittle>().value == 3);
+    entity.addComponent<Brittle>(5, false);
+    assert(entity.getComponent<Brittle>().value == 5);
+    assert(entity.getComponent<Brittle>().entity == &entity);
+    assert(alive == 2);
+
+    // Copie et destruction voient des composants valides
+    {
+        ECS::Manager copy;
+        manager.cloneInto(copy);
+        assert(alive == 4);
+    }
+    assert(alive == 2);
+    entity.destroy();
+    manager.refresh();
+    assert(alive == 0);
+
+    std::cout << "AddComponentExceptionTest: OK\n";
+    return 0;
+}
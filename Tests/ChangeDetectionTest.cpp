@@ -0,0 +1,126 @@
+/*
+ * Régression: l'accès modifiable (getComponent<T>, View sur T non const)
+ * avance le tick de change detection, l'accès const (getComponent<const T>,
+ * View sur const T) ne le touche pas. hasChanged le voit au update() suivant.
+ * Un composant absent lève sans écrire de tick dans le chunk.
+ *
+ * g++ -std=c++17 -I.. ChangeDetectionTest.cpp -o ChangeDetectionTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+
+struct Position : ECS::Component
+{
+    float x = 0.0f;
+};
+
+struct Velocity : ECS::Component
+{
+    float x = 0.0f;
+};
+
+struct Missing : ECS::Component
+{
+};
+
+// Retient si Position a changé pour l'entité observée au dernier update()
+struct Watcher : ECS::System
+{
+    ECS::EntityHandle watched;
+    bool changed = false;
+
+    Watcher() { requireComponent<Position>(); }
+
+    void update(float) override
+    {
+        ECS::Entity *entity = manager->getEntity(watched);
+        changed = entity && hasChanged<Position>(*entity);
+    }
+};
+
+int main()
+{
+    ECS::Manager manager;
+    auto *watcher = manager.addSystem<Watcher>();
+
+    auto &entity = manager.createEntity();
+    entity.addComponent<Position>();
+    entity.addComponent<Velocity>();
+    manager.refresh();
+    watcher->watched = entity.getHandle();
+
+    // Ajout: signalé une fois, puis plus rien
+    manager.update(0.0f);
+    assert(watcher->changed);
+    manager.update(0.0f);
+    assert(!watcher->changed);
+
+    // Lecture const: pas de tick
+    std::uint32_t tick = entity.getChangeTick<Position>();
+    float x = entity.getComponent<const Position>().x;
+    assert(x == 0.0f);
+    assert(entity.getChangeTick<Position>() == tick);
+    manager.update(0.0f);
+    assert(!watcher->changed);
+
+    // getComponent modifiable: signalé au update() suivant
+    entity.getComponent<Position>().x = 1.0f;
+    assert(entity.getChangeTick<Position>() == manager.getChangeTick());
+    manager.update(0.0f);
+    assert(watcher->changed);
+    manager.update(0.0f);
+    assert(!watcher->changed);
+
+    // View const: rien de signalé, même pour les colonnes lues
+    tick = entity.getChangeTick<Position>();
+    int visited = 0;
+    manager.view<const Position, const Velocity>().each([&](const Position &, const Velocity &) { ++visited; });
+    assert(visited == 1);
+    assert(entity.getChangeTick<Position>() == tick);
+    manager.update(0.0f);
+    assert(!watcher->changed);
+
+    // View mixte: seule la colonne non const est signalée
+    std::uint32_t velocityTick = entity.getChangeTick<Velocity>();
+    manager.view<Position, const Velocity>().each([](Position &position, const Velocity &velocity) { position.x += velocity.x; });
+    assert(entity.getChangeTick<Position>() == manager.getChangeTick());
+    assert(entity.getChangeTick<Velocity>() == velocityTick);
+    manager.update(0.0f);
+    assert(watcher->changed);
+
+    // eachChunk et parallelEach signalent aussi
+    manager.update(0.0f);
+    assert(!watcher->changed);
+    manager.view<Position>().eachChunk([](std::size_t, Position *) {});
+    manager.update(0.0f);
+    assert(watcher->changed);
+
+    manager.update(0.0f);
+    assert(!watcher->changed);
+    manager.view<Position>().parallelEach([](Position &) {});
+    manager.update(0.0f);
+    assert(watcher->changed);
+
+    // Composant absent: exception, aucun tick écrit, markChanged sans effet
+    manager.update(0.0f);
+    tick = entity.getChangeTick<Position>();
+    velocityTick = entity.getChangeTick<Velocity>();
+    bool threw = false;
+    try
+    {
+        entity.getComponent<Missing>();
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    assert(threw);
+    entity.markChanged<Missing>();
+    assert(entity.getChangeTick<Missing>() == 0);
+    assert(entity.getChangeTick<Position>() == tick);
+    assert(entity.getChangeTick<Velocity>() == velocityTick);
+
+    std::cout << "ChangeDetectionTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Vérifie cloneInto/restoreFrom: composants et handles restaurés, seules les
+ * entités qui entrent/sortent d'un système reçoivent onEntityAdded/Removed,
+ * et un composant non copiable lève avant de toucher le monde cible.
+ *
+ * g++ -std=c++17 -I.. CloneTest.cpp -o CloneTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+struct Position : ECS::Component
+{
+    float x = 0.0f;
+    Position() = default;
+    explicit Position(float value) : x(value) {}
+};
+
+// Non copiable: interdit le clone
+struct Unique : ECS::Component
+{
+    std::unique_ptr<int> value = std::make_unique<int>(1);
+};
+
+// Enregistre les entrées/sorties de sa liste
+struct Tracker : ECS::System
+{
+    std::vector<ECS::EntityHandle> added;
+    std::vector<ECS::EntityHandle> removed;
+
+    Tracker() { requireComponent<Position>(); }
+
+    void onEntityAdded(ECS::Entity *entity) override { added.push_back(entity->getHandle()); }
+    void onEntityRemoved(ECS::Entity *entity) override { removed.push_back(entity->getHandle()); }
+
+    void reset()
+    {
+        added.clear();
+        removed.clear();
+    }
+};
+
+int main()
+{
+    ECS::Manager world;
+    ECS::Manager saved;
+    auto *tracker = world.addSystem<Tracker>();
+    auto *savedTracker = saved.addSystem<Tracker>();
+
+    auto &a = world.createEntity();
+    a.addComponent<Position>(1.0f);
+    auto &b = world.createEntity();
+    b.addComponent<Position>(2.0f);
+    world.refresh();
+    ECS::EntityHandle handleA = a.getHandle();
+    ECS::EntityHandle handleB = b.getHandle();
+
+    // Premier clone: la cible vide reçoit les deux entités
+    world.cloneInto(saved);
+    assert(saved.getEntities().size() == 2);
+    assert(savedTracker->added.size() == 2 && savedTracker->removed.empty());
+    assert(saved.getEntity(handleB)->getComponent<const Position>().x == 2.0f);
+    assert(saved.getEntity(handleB) != world.getEntity(handleB));
+
+    // Prédiction: A détruite, B modifiée, C créée
+    a.destroy();
+    b.getComponent<Position>().x = 20.0f;
+    auto &c = world.createEntity();
+    c.addComponent<Position>(3.0f);
+    world.refresh();
+    ECS::EntityHandle handleC = c.getHandle();
+    assert(!world.getEntity(handleA));
+
+    // Rollback: seul C sort, seul A revient, B ne reçoit rien
+    tracker->reset();
+    world.restoreFrom(saved);
+    assert(tracker->removed.size() == 1 && tracker->removed[0] == handleC);
+    assert(tracker->added.size() == 1 && tracker->added[0] == handleA);
+    assert(tracker->getEntities().size() == 2);
+    assert(world.getEntity(handleA) && world.getEntity(handleA)->getComponent<const Position>().x == 1.0f);
+    assert(world.getEntity(handleB)->getComponent<const Position>().x == 2.0f);
+    assert(!world.getEntity(handleC));
+
+    // Le monde restauré reste utilisable
+    world.getEntity(handleB)->destroy();
+    world.createEntity().addComponent<Position>(4.0f);
+    world.refresh();
+    assert(world.getEntities().size() == 2);
+    assert(saved.getEntities().size() == 2);
+
+    // Composant non copiable: exception, cible intacte et sans notification
+    ECS::Manager broken;
+    broken.createEntity().addComponent<Unique>();
+    broken.createEntity().addComponent<Position>(9.0f);
+    broken.refresh();
+    savedTracker->reset();
+    bool threw = false;
+    try
+    {
+        broken.cloneInto(saved);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    assert(threw);
+    assert(savedTracker->added.empty() && savedTracker->removed.empty());
+    assert(saved.getEntities().size() == 2);
+    assert(saved.getEntity(handleA)->getComponent<const Position>().x == 1.0f);
+    assert(saved.getEntity(handleB)->getComponent<const Position>().x == 2.0f);
+
+    // Systèmes différents: appartenance recalculée au prochain update()
+    ECS::Manager bare;
+    saved.cloneInto(bare);
+    auto *bareTracker = bare.addSystem<Tracker>();
+    bare.update(0.0f);
+    assert(bareTracker->getEntities().size() == 2);
+
+    std::cout << "CloneTest: OK\n";
+    return 0;
+}
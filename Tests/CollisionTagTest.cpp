@@ -0,0 +1,49 @@
+/*
+ * Régression: le tag de CollisionComponent n'existe plus qu'en version
+ * internée, getTag / hasTag / la sérialisation restent donc cohérents. Pas de
+ * champ public tag: une ancienne écriture directe ne compile plus.
+ *
+ * g++ -std=c++17 -I.. CollisionTagTest.cpp -o CollisionTagTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/CollisionComponent.h"
+#include <cassert>
+#include <iostream>
+#include <type_traits>
+
+template <typename T, typename = void>
+struct HasTagField : std::false_type
+{
+};
+
+template <typename T>
+struct HasTagField<T, std::void_t<decltype(&T::tag)>> : std::true_type
+{
+};
+
+static_assert(!HasTagField<CollisionComponent>::value, "CollisionComponent: passer par setTag/getTag");
+
+int main()
+{
+    const ECS::TagID player = ECS::getTagID("player");
+    const ECS::TagID wall = ECS::getTagID("wall");
+
+    CollisionComponent collider(0.0f, 0.0f, 16.0f, 16.0f, "player");
+    assert(collider.hasTag(player));
+    assert(collider.getTag() == "player");
+
+    collider.setTag("wall");
+    assert(collider.hasTag(wall));
+    assert(!collider.hasTag(player));
+    assert(collider.getTag() == "wall");
+
+    collider.setTag(player);
+    assert(collider.getTagID() == player);
+    assert(collider.getTag() == "player");
+
+    CollisionComponent byDefault;
+    assert(byDefault.getTag() == "default");
+
+    std::cout << "CollisionTagTest OK" << std::endl;
+    return 0;
+}
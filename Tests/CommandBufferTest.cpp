@@ -0,0 +1,61 @@
+/*
+ * Régression: une EntityRef pending périmée (d'avant le dernier playback) ou
+ * venant d'un autre buffer ne doit ni lire hors de la table des entités
+ * créées, ni viser une autre entité: la commande est ignorée.
+ *
+ * g++ -std=c++17 -I.. CommandBufferTest.cpp -o CommandBufferTest -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+
+struct Marker : public ECS::Component
+{
+    int value = 0;
+    Marker() = default;
+    explicit Marker(int v) : value(v) {}
+};
+
+int main()
+{
+    ECS::Manager manager;
+    ECS::CommandBuffer &commands = manager.getCommandBuffer();
+
+    // Cas normal: la ref pending est résolue au playback
+    auto first = commands.createEntity();
+    commands.addComponent<Marker>(first, 1);
+    manager.refresh();
+    assert(manager.getEntities().size() == 1);
+    assert(manager.getEntities()[0]->getComponent<Marker>().value == 1);
+
+    // Ref d'avant le dernier playback: index 0 valable dans le nouveau tableau,
+    // elle viserait la nouvelle entité si elle n'était pas rejetée
+    auto second = commands.createEntity();
+    commands.addComponent<Marker>(first, 2);
+    manager.refresh();
+    assert(manager.getEntities().size() == 2);
+    ECS::Entity *created = manager.getEntities()[1];
+    assert(!created->hasComponent<Marker>());
+    (void)second;
+
+    // Ref d'un autre buffer, avec un index hors de la table de ce buffer
+    ECS::CommandBuffer other;
+    other.createEntity();
+    other.createEntity();
+    auto foreign = other.createEntity();
+    commands.addComponent<Marker>(foreign, 3);
+    commands.destroy(foreign);
+    assert(commands.empty());
+
+    // Ref forgée: index pending sans création correspondante
+    ECS::CommandBuffer::EntityRef forged;
+    forged.pending = 5;
+    commands.removeComponent<Marker>(forged);
+    assert(commands.empty());
+
+    manager.refresh();
+    assert(manager.getEntities().size() == 2);
+
+    std::cout << "CommandBufferTest OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * Benchmark de ComponentBitSet::containsAll (test d'une signature de système
+ * contre celle d'une entité), comparé à std::bitset<MAX_COMPONENTS>
+ *
+ * 256 signatures d'entité (8 composants) x 64 masques (2 composants), appel
+ * non inliné comme dans Manager::updateMembership; meilleur de 7 mesures.
+ * À compiler pour chaque configuration, ex:
+ *
+ * g++ -std=c++17 -O2 -I.. ComponentBitSetBenchmark.cpp -o bench -lSDL2 -pthread
+ * g++ -std=c++17 -O2 -DECS_BITSET_SIMD=0 ...
+ * g++ -std=c++17 -O2 -mavx2 ...
+ * g++ -std=c++17 -O2 -DECS_MAX_COMPONENTS=64 ...
+ */
+#include "../ECS.h"
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+constexpr int ENTITY_SIGNATURES = 256;
+constexpr int MASKS = 64;
+constexpr int REPEATS = 4000;
+constexpr int RUNS = 7;
+constexpr int USED_COMPONENTS = 48; // Types réellement utilisés par un jeu
+
+using Reference = std::bitset<ECS::MAX_COMPONENTS>;
+
+__attribute__((noinline)) bool matchBitSet(const ECS::ComponentBitSet &entity, const ECS::ComponentBitSet &mask)
+{
+    return entity.containsAll(mask);
+}
+
+__attribute__((noinline)) bool matchReference(const Reference &entity, const Reference &mask)
+{
+    return (entity & mask) == mask;
+}
+
+template <typename Bits, typename Match>
+double nanosecondsPerMatch(Match match)
+{
+    std::mt19937_64 rng(1);
+    std::vector<Bits> entities(ENTITY_SIGNATURES);
+    std::vector<Bits> masks(MASKS);
+    for (auto &bits : entities)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            bits.set(rng() % USED_COMPONENTS);
+        }
+    }
+    for (auto &bits : masks)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            bits.set(rng() % USED_COMPONENTS);
+        }
+    }
+
+    double best = 1e30;
+    volatile std::size_t sink = 0;
+    for (int run = 0; run < RUNS; ++run)
+    {
+        std::size_t matches = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEATS; ++r)
+        {
+            for (const Bits &mask : masks)
+            {
+                for (const Bits &entity : entities)
+                {
+                    matches += match(entity, mask);
+                }
+            }
+        }
+        double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, elapsed / (double(ENTITY_SIGNATURES) * MASKS * REPEATS));
+        sink = sink + matches;
+    }
+    return best;
+}
+
+int main()
+{
+#if !ECS_BITSET_SIMD
+    const char *path = "scalar";
+#elif defined(__AVX2__)
+    const char *path = "AVX2";
+#else
+    const char *path = "scalar";
+#endif
+
+    std::printf("MAX_COMPONENTS=%zu, containsAll path: %s\n", ECS::MAX_COMPONENTS, path);
+    std::printf("  std::bitset      %.3f ns/match\n", nanosecondsPerMatch<Reference>(matchReference));
+    std::printf("  ComponentBitSet  %.3f ns/match\n", nanosecondsPerMatch<ECS::ComponentBitSet>(matchBitSet));
+    return 0;
+}
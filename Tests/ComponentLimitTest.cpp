@@ -0,0 +1,67 @@
+/*
+ * Régression: au-delà de MAX_COMPONENTS types, l'enregistrement du type lève
+ * une exception au lieu de distribuer un ID qui déborde des ComponentBitSet
+ * (requireComponent écrivait hors du tableau de mots).
+ *
+ * g++ -std=c++17 -I.. ComponentLimitTest.cpp -o ComponentLimitTest -pthread
+ */
+#define ECS_MAX_COMPONENTS 64
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+template <int N>
+struct Numbered : public ECS::Component
+{
+};
+
+template <int... Ns>
+void registerAll(std::integer_sequence<int, Ns...>)
+{
+    (void)std::initializer_list<int>{(ECS::getComponentTypeID<Numbered<Ns>>(), 0)...};
+}
+
+struct OverflowSystem : public ECS::System
+{
+    OverflowSystem() { requireComponent<Numbered<ECS::MAX_COMPONENTS>>(); }
+};
+
+int main()
+{
+    registerAll(std::make_integer_sequence<int, ECS::MAX_COMPONENTS>());
+    assert(ECS::getComponentTypeID<Numbered<ECS::MAX_COMPONENTS - 1>>() == ECS::MAX_COMPONENTS - 1);
+
+    // Chaque chemin passe par le registre: système, entité
+    bool thrown = false;
+    try
+    {
+        OverflowSystem system;
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    ECS::Manager manager;
+    auto &entity = manager.createEntity();
+    thrown = false;
+    try
+    {
+        entity.addComponent<Numbered<ECS::MAX_COMPONENTS + 1>>();
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // L'entité reste utilisable avec les types enregistrés
+    entity.addComponent<Numbered<0>>();
+    assert(entity.hasComponent<Numbered<0>>());
+
+    std::cout << "ComponentLimitTest: OK\n";
+    return 0;
+}
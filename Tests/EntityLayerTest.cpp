@@ -0,0 +1,50 @@
+/*
+ * Régression: addLayer / removeLayer / setTag sur une entité détruite mais pas
+ * encore retirée (avant refresh) ne doivent pas la réinscrire dans les index,
+ * sinon un Entity* périmé survit au recyclage du slot.
+ *
+ * g++ -std=c++17 -I.. EntityLayerTest.cpp -o EntityLayerTest -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+
+int main()
+{
+    ECS::Manager manager;
+    const ECS::Layer enemies = 1;
+    const ECS::Layer renderable = 2;
+    const ECS::TagID boss = ECS::getTagID("boss");
+
+    auto &keep = manager.createEntity();
+    keep.addLayer(renderable);
+
+    auto &doomed = manager.createEntity();
+    doomed.addLayer(renderable);
+    doomed.destroy();
+
+    // Toutes ces modifications arrivent trop tard et sont ignorées
+    doomed.addLayer(enemies);
+    doomed.removeLayer(renderable);
+    doomed.setTag(boss);
+    assert(manager.getEntitiesByLayer(enemies).empty());
+    assert(manager.getEntitiesByLayer(renderable).size() == 1);
+    assert(manager.getEntitiesByTag(boss).empty());
+
+    manager.refresh();
+
+    // Le slot est recyclé: les listes ne doivent contenir que des entités vivantes
+    auto &reused = manager.createEntity();
+    reused.addLayer(renderable);
+    assert(manager.getEntitiesByLayer(enemies).empty());
+    assert(manager.getEntitiesByLayer(renderable).size() == 2);
+    for (ECS::Entity *entity : manager.getEntitiesByLayer(renderable))
+    {
+        assert(entity == &keep || entity == &reused);
+        assert(entity->isActive());
+    }
+    assert(manager.getEntitiesByTag(boss).empty());
+
+    std::cout << "EntityLayerTest OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Manager::sampleMemory: composants et ressources (la tilemap est d'habitude
+ * une ressource), pics et variations entre deux samples.
+ *
+ * g++ -std=c++17 -I.. MemoryReportTest.cpp -o MemoryReportTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/TileMapComponent.h"
+#include "../Components/TransformComponent.h"
+#include <cassert>
+#include <iostream>
+
+static const ECS::MemoryUsage *find(const std::vector<ECS::MemoryUsage> &list, const std::string &name)
+{
+    for (const auto &usage : list)
+    {
+        if (usage.name == name)
+        {
+            return &usage;
+        }
+    }
+    return nullptr;
+}
+
+int main()
+{
+    ECS::Manager manager;
+    for (int i = 0; i < 100; ++i)
+    {
+        manager.createEntity().addComponent<TransformComponent>();
+    }
+
+    auto &map = manager.setResource<TileMapComponent>();
+    Layer layer;
+    layer.name = "ground";
+    layer.width = layer.height = 100;
+    layer.tiles.assign(100 * 100, 1);
+    map.layers.push_back(layer);
+    manager.refresh();
+
+    const ECS::MemoryReport &first = manager.sampleMemory();
+    const ECS::MemoryUsage *transforms = find(first.components, "TransformComponent");
+    assert(transforms && transforms->count == 100);
+    assert(transforms->bytes == 100 * sizeof(TransformComponent));
+
+    const ECS::MemoryUsage *tileMap = find(first.resources, "TileMapComponent");
+    assert(tileMap && tileMap->bytes >= sizeof(TileMapComponent) + 100 * 100 * sizeof(int));
+    std::size_t mapBytes = tileMap->bytes;
+    assert(first.total.bytes >= mapBytes);
+
+    // Map plus petite: delta négatif, pic conservé
+    manager.resource<TileMapComponent>()->layers.clear();
+    manager.resource<TileMapComponent>()->layers.shrink_to_fit();
+    const ECS::MemoryReport &second = manager.sampleMemory();
+    tileMap = find(second.resources, "TileMapComponent");
+    assert(tileMap && tileMap->bytes < mapBytes);
+    assert(tileMap->peakBytes == mapBytes);
+    assert(tileMap->deltaBytes == static_cast<std::ptrdiff_t>(tileMap->bytes) - static_cast<std::ptrdiff_t>(mapBytes));
+
+    // Ressource retirée: toujours listée, à zéro
+    manager.removeResource<TileMapComponent>();
+    tileMap = find(manager.sampleMemory().resources, "TileMapComponent");
+    assert(tileMap && tileMap->bytes == 0 && tileMap->count == 0);
+
+    manager.writeMemoryReport(std::cout);
+    std::cout << "MemoryReportTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Régression: MovementSystem parcourt sa propre liste d'entités. Une exclusion
+ * ajoutée à sa signature est respectée, et une entité détruite mais pas encore
+ * retirée par refresh() n'est plus déplacée. Par défaut un pas par frame avec le
+ * deltaTime de la frame; en pas fixes, une position écrite directement entre deux
+ * pas n'est pas interpolée (pas de glissement depuis l'ancienne position).
+ *
+ * g++ -std=c++17 -I.. MovementSystemTest.cpp ../Systems/MovementSystem.cpp -o MovementSystemTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/TransformComponent.h"
+#include "../Systems/MovementSystem.h"
+#include <cassert>
+#include <iostream>
+
+struct Frozen : ECS::Component
+{
+};
+
+// Variante de jeu: les entités gelées ne bougent pas
+struct FreezableMovementSystem : MovementSystem
+{
+    FreezableMovementSystem() { excludeComponent<Frozen>(); }
+};
+
+int main()
+{
+    const float STEP = 1.0f / MovementSystem::UPDATE_RATE;
+
+    ECS::Manager manager;
+    manager.addSystem<FreezableMovementSystem>();
+
+    auto &moving = manager.createEntity();
+    moving.addComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    auto &frozen = manager.createEntity();
+    frozen.addComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    frozen.addComponent<Frozen>();
+    auto &doomed = manager.createEntity();
+    doomed.addComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    manager.refresh();
+
+    manager.update(STEP);
+    assert(moving.getComponent<const TransformComponent>().position.x > 0.0f);
+    assert(frozen.getComponent<const TransformComponent>().position.x == 0.0f);
+    float doomedX = doomed.getComponent<const TransformComponent>().position.x;
+    assert(doomedX > 0.0f);
+
+    // Détruite pendant la frame: plus déplacée avant le refresh()
+    doomed.destroy();
+    manager.update(STEP);
+    assert(doomed.getComponent<const TransformComponent>().position.x == doomedX);
+    assert(frozen.getComponent<const TransformComponent>().position.x == 0.0f);
+    manager.refresh();
+
+    // Par défaut: deltaTime de la frame, quel qu'il soit
+    ECS::Manager variable;
+    variable.addSystem<MovementSystem>();
+    auto &walker = variable.createEntity();
+    walker.addComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    variable.refresh();
+    variable.update(0.5f);
+    assert(walker.getComponent<const TransformComponent>().position.x == 30.0f);
+
+    // Pas fixes sur demande: rendu interpolé entre deux pas
+    ECS::Manager fixed;
+    auto *movement = fixed.addSystem<MovementSystem>(MovementSystem::UPDATE_RATE);
+    auto &runner = fixed.createEntity();
+    runner.addComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    fixed.refresh();
+    fixed.update(STEP * 1.5f);
+    const TransformComponent &transform = runner.getComponent<const TransformComponent>();
+    float alpha = movement->getInterpolationAlpha();
+    assert(alpha > 0.0f && alpha < 1.0f);
+    assert(transform.isInterpolating());
+    assert(transform.interpolatedPosition(alpha).x < transform.position.x);
+
+    // Écriture directe (spawn, téléportation): dessinée telle quelle, sans glisser
+    runner.getComponent<TransformComponent>().position = Vector2D(500.0f, 0.0f);
+    assert(!transform.isInterpolating());
+    assert(transform.interpolatedPosition(alpha).x == 500.0f);
+    fixed.update(STEP);
+    assert(transform.previousPosition.x == 500.0f);
+    assert(transform.position.x > 500.0f);
+    assert(transform.isInStep());
+
+    std::cout << "MovementSystemTest: OK\n";
+    return 0;
+}
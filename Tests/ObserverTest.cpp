@@ -0,0 +1,157 @@
+/*
+ * Vérifie les observers: un seul appel par refresh() avec toutes les entités
+ * concernées, Changed livré une seule fois par modification, et les
+ * changements structurels faits depuis un callback livrés au flush suivant,
+ * ni perdus ni répétés.
+ *
+ * g++ -std=c++17 -I.. ObserverTest.cpp -o ObserverTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+struct Position : ECS::Component
+{
+    float x = 0.0f;
+};
+
+struct Velocity : ECS::Component
+{
+    float x = 0.0f;
+};
+
+// Mémorise les batchs reçus
+struct Recorder
+{
+    int calls = 0;
+    std::vector<ECS::EntityHandle> last;
+
+    ECS::ObserverCallback callback()
+    {
+        return [this](const std::vector<ECS::EntityHandle> &batch)
+        {
+            ++calls;
+            last = batch;
+        };
+    }
+
+    void reset()
+    {
+        calls = 0;
+        last.clear();
+    }
+};
+
+int main()
+{
+    ECS::Manager manager;
+    Recorder added, removed, changed;
+    manager.observe<Position>(ECS::ComponentEvent::Added, added.callback());
+    manager.observe<Position>(ECS::ComponentEvent::Removed, removed.callback());
+    ECS::ObserverID changedID = manager.observe<Position>(ECS::ComponentEvent::Changed, changed.callback());
+
+    // Batch: rien avant refresh(), puis un seul appel pour toutes les entités
+    const int COUNT = 100;
+    std::vector<ECS::Entity *> entities;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        entities.push_back(&manager.createEntity());
+        entities.back()->addComponent<Position>();
+    }
+    assert(added.calls == 0);
+    manager.refresh();
+    assert(added.calls == 1 && added.last.size() == COUNT);
+    assert(changed.calls == 1 && changed.last.size() == COUNT);
+    assert(removed.calls == 0);
+
+    // Rien de nouveau: aucun appel
+    added.reset();
+    changed.reset();
+    manager.refresh();
+    assert(added.calls == 0 && changed.calls == 0);
+
+    // Plusieurs écritures sur la même entité: signalée une seule fois
+    entities[3]->getComponent<Position>().x = 1.0f;
+    entities[3]->getComponent<Position>().x = 2.0f;
+    entities[3]->markChanged<Position>();
+    entities[5]->getComponent<Position>().x = 1.0f;
+    float read = entities[7]->getComponent<const Position>().x; // Lecture: pas signalée
+    assert(read == 0.0f);
+    manager.refresh();
+    assert(changed.calls == 1 && changed.last.size() == 2);
+    assert(changed.last[0] == entities[3]->getHandle() || changed.last[1] == entities[3]->getHandle());
+    changed.reset();
+    manager.refresh();
+    assert(changed.calls == 0);
+
+    // Même chose à travers update(): le tick avance mais la livraison reste unique
+    entities[9]->getComponent<Position>().x = 3.0f;
+    manager.update(0.0f);
+    manager.refresh();
+    assert(changed.calls == 1 && changed.last.size() == 1 && changed.last[0] == entities[9]->getHandle());
+    changed.reset();
+    manager.update(0.0f);
+    manager.refresh();
+    assert(changed.calls == 0);
+
+    // Removed: composant retiré ou entité détruite, dans le même batch
+    ECS::EntityHandle destroyed = entities[0]->getHandle();
+    entities[0]->destroy();
+    entities[1]->removeComponent<Position>();
+    manager.refresh();
+    assert(removed.calls == 1 && removed.last.size() == 2);
+    assert(!manager.getEntity(destroyed));
+    removed.reset();
+
+    // Changements structurels et écritures depuis un callback
+    Recorder velocityAdded;
+    manager.observe<Velocity>(ECS::ComponentEvent::Added, velocityAdded.callback());
+    std::vector<ECS::EntityHandle> spawned;
+    ECS::ObserverID spawner = manager.observe<Position>(ECS::ComponentEvent::Changed,
+        [&](const std::vector<ECS::EntityHandle> &batch)
+        {
+            for (ECS::EntityHandle handle : batch)
+            {
+                ECS::Entity *entity = manager.getEntity(handle);
+                if (!entity)
+                    continue;
+                // Réécrit le composant observé, ajoute un composant, crée une entité
+                entity->getComponent<Position>().x += 10.0f;
+                entity->addComponent<Velocity>();
+                auto &child = manager.createEntity();
+                child.addComponent<Position>();
+                spawned.push_back(child.getHandle());
+            }
+        });
+
+    entities[2]->getComponent<Position>().x = 5.0f;
+    added.reset();
+    changed.reset();
+    manager.refresh();
+    assert(changed.calls == 1 && changed.last.size() == 1);
+    assert(spawned.size() == 1);
+    assert(entities[2]->getComponent<const Position>().x == 15.0f);
+
+    // Flush suivant: l'entité réécrite et l'entité créée, une fois chacune
+    manager.unobserve(spawner);
+    changed.reset();
+    manager.refresh();
+    assert(added.calls == 1 && added.last.size() == 1 && added.last[0] == spawned[0]);
+    assert(changed.calls == 1 && changed.last.size() == 2);
+    assert(velocityAdded.calls == 1 && velocityAdded.last.size() == 1);
+    assert(manager.getEntity(spawned[0]));
+    changed.reset();
+    added.reset();
+    manager.refresh();
+    assert(changed.calls == 0 && added.calls == 0);
+
+    // unobserve: plus d'appel
+    manager.unobserve(changedID);
+    entities[4]->getComponent<Position>().x = 1.0f;
+    manager.refresh();
+    assert(changed.calls == 0);
+
+    std::cout << "ObserverTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * Vérifie View::parallelEach et System::parallelForEach: chaque entité est
+ * visitée exactement une fois, sur plusieurs archetypes et chunks, avec le
+ * pool de threads, sous le seuil et sans pool (repli séquentiel).
+ * À lancer aussi avec -fsanitize=thread.
+ *
+ * g++ -std=c++17 -I.. ParallelEachTest.cpp -o ParallelEachTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+
+struct Counter : ECS::Component
+{
+    int visits = 0;
+};
+
+struct Extra : ECS::Component
+{
+};
+
+// Incrémente le compteur de chacune de ses entités
+struct CountSystem : ECS::System
+{
+    CountSystem() { requireComponent<Counter>(); }
+
+    void update(float) override
+    {
+        parallelForEach([](ECS::Entity *entity) { ++entity->getComponent<Counter>().visits; }, 64);
+    }
+};
+
+static bool allVisited(ECS::Manager &manager, int expected)
+{
+    int wrong = 0;
+    manager.view<const Counter>().each([&](const Counter &counter)
+                                       {
+                                           if (counter.visits != expected)
+                                               ++wrong;
+                                       });
+    return wrong == 0;
+}
+
+int main()
+{
+    ECS::Manager manager;
+    manager.setThreadCount(4);
+
+    // Deux archetypes, plusieurs chunks chacun
+    const int COUNT = 10000;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        auto &entity = manager.createEntity();
+        entity.addComponent<Counter>();
+        if (i % 2)
+            entity.addComponent<Extra>();
+    }
+    manager.refresh();
+
+    // Lots de 64 entités sur le pool
+    std::atomic<int> visited{0};
+    manager.view<Counter>().parallelEach([&](Counter &counter)
+                                         {
+                                             ++counter.visits;
+                                             ++visited;
+                                         },
+                                         64, 0);
+    assert(visited == COUNT);
+    assert(allVisited(manager, 1));
+
+    // Entité en premier paramètre, lot par défaut
+    std::atomic<int> extras{0};
+    manager.view<Counter>().parallelEach([&](ECS::Entity &entity, Counter &counter)
+                                         {
+                                             ++counter.visits;
+                                             if (entity.hasComponent<Extra>())
+                                                 ++extras;
+                                         },
+                                         ECS::DEFAULT_GRAIN_SIZE, 0);
+    assert(extras == COUNT / 2);
+    assert(allVisited(manager, 2));
+
+    // Sous le seuil: séquentiel, même résultat
+    manager.view<Counter>().parallelEach([](Counter &counter) { ++counter.visits; }, 64, COUNT + 1);
+    assert(allVisited(manager, 3));
+
+    // parallelForEach depuis un système
+    auto *system = manager.addSystem<CountSystem>();
+    system->setParallelThreshold(0);
+    manager.update(0.0f);
+    assert(allVisited(manager, 4));
+
+    // Sans pool: repli séquentiel
+    manager.setThreadCount(1);
+    manager.view<Counter>().parallelEach([](Counter &counter) { ++counter.visits; }, 64, 0);
+    manager.update(0.0f);
+    assert(allVisited(manager, 6));
+
+    std::cout << "ParallelEachTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Régression: deux systèmes en conflit (S1 écrit A, S2 lit A) avec le pool de
+ * threads. S2 ne doit tourner qu'une fois par frame, jamais en même temps que
+ * lui-même ni avant S1.
+ *
+ * g++ -std=c++17 -I.. ParallelSchedulerTest.cpp -o ParallelSchedulerTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+
+struct A : ECS::Component
+{
+    int value = 0;
+};
+
+std::atomic<int> writerRuns{0};
+std::atomic<int> readerRuns{0};
+std::atomic<int> readersInside{0};
+
+struct Writer : ECS::System
+{
+    Writer() { requireComponent<A>(); }
+    void update(float) override { ++writerRuns; }
+};
+
+struct Reader : ECS::System
+{
+    Reader() { requireComponent<A>(ECS::Access::Read); }
+    void update(float) override
+    {
+        assert(++readersInside == 1);
+        assert(readerRuns + 1 == writerRuns);
+        ++readerRuns;
+        --readersInside;
+    }
+};
+
+int main()
+{
+    ECS::Manager manager;
+    manager.setThreadCount(2);
+    manager.addSystem<Writer>();
+    manager.addSystem<Reader>();
+    manager.createEntity().addComponent<A>();
+
+    const int FRAMES = 20000;
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        manager.update(1.0f / 60.0f);
+        assert(writerRuns == frame + 1);
+        assert(readerRuns == frame + 1);
+    }
+
+    std::cout << "ParallelSchedulerTest: OK\n";
+    return 0;
+}
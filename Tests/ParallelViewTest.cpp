@@ -0,0 +1,89 @@
+/*
+ * Régression: des systèmes sans conflit d'accès appellent manager->view<...>()
+ * en même temps depuis update(). Le cache des requêtes est créé puis complété
+ * pendant les passes parallèles (nouveaux archetypes entre deux frames).
+ * À lancer aussi avec -fsanitize=thread.
+ *
+ * g++ -std=c++17 -I.. ParallelViewTest.cpp -o ParallelViewTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <utility>
+
+constexpr std::size_t TAGS = 6;
+
+template <std::size_t I>
+struct Tag : ECS::Component
+{
+};
+
+std::size_t expectedSingle[TAGS];
+std::size_t expectedPair[TAGS];
+std::atomic<int> runs{0};
+
+// Lit Tag<I> et Tag<I + 1>: aucun système n'écrit, tous tournent en parallèle
+template <std::size_t I>
+struct ViewSystem : ECS::System
+{
+    static constexpr std::size_t NEXT = (I + 1) % TAGS;
+
+    ViewSystem()
+    {
+        accessComponent<Tag<I>>(ECS::Access::Read);
+        accessComponent<Tag<NEXT>>(ECS::Access::Read);
+    }
+
+    void update(float) override
+    {
+        std::size_t single = 0;
+        manager->view<Tag<I>>().each([&](Tag<I> &) { ++single; });
+        assert(single == expectedSingle[I]);
+        assert((manager->view<Tag<I>, Tag<NEXT>>().size() == expectedPair[I]));
+        ++runs;
+    }
+};
+
+template <std::size_t... Is>
+void addSystems(ECS::Manager &manager, std::index_sequence<Is...>)
+{
+    (manager.addSystem<ViewSystem<Is>>(), ...);
+}
+
+template <std::size_t... Is>
+void addTags(ECS::Entity &entity, unsigned mask, std::index_sequence<Is...>)
+{
+    ((mask & (1u << Is) ? (void)entity.addComponent<Tag<Is>>() : (void)0), ...);
+}
+
+int main()
+{
+    ECS::Manager manager;
+    manager.setThreadCount(4);
+    addSystems(manager, std::make_index_sequence<TAGS>());
+
+    const int FRAMES = 2000;
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        // Une nouvelle combinaison de tags de temps en temps: nouveaux archetypes
+        unsigned mask = (static_cast<unsigned>(frame) * 37u) % (1u << TAGS);
+        if (frame % 4 == 0)
+        {
+            addTags(manager.createEntity(), mask, std::make_index_sequence<TAGS>());
+            for (std::size_t i = 0; i < TAGS; ++i)
+            {
+                bool single = mask & (1u << i);
+                expectedSingle[i] += single;
+                expectedPair[i] += single && (mask & (1u << ((i + 1) % TAGS)));
+            }
+        }
+
+        manager.refresh();
+        manager.update(1.0f / 60.0f);
+        assert(runs == (frame + 1) * static_cast<int>(TAGS));
+    }
+
+    std::cout << "ParallelViewTest: OK\n";
+    return 0;
+}
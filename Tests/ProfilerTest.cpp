@@ -0,0 +1,104 @@
+/*
+ * Vérifie le profiler: statistiques glissantes (moyenne, p95, max, fenêtre),
+ * mesures des systèmes et du Manager dans la trace Chrome, scopes manuels,
+ * échappement des noms et setEnabled. Compilé avec ECS_ENABLE_PROFILER=0:
+ * aucune mesure, statistiques des systèmes vides.
+ *
+ * g++ -std=c++17 -I.. ProfilerTest.cpp -o ProfilerTest -lSDL2 -pthread
+ * g++ -std=c++17 -DECS_ENABLE_PROFILER=0 -I.. ProfilerTest.cpp -o ProfilerTestDisabled -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+struct ProfiledSystem : ECS::System
+{
+    void update(float) override { ECS_PROFILE_SCOPE("ProfiledSystem::inner"); }
+    void render(SDL_Renderer *) override {}
+};
+
+static std::string trace()
+{
+    std::ostringstream out;
+    Profiler::writeChromeTrace(out);
+    return out.str();
+}
+
+static bool contains(const std::string &text, const std::string &part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+int main()
+{
+    // Statistiques glissantes: indépendantes du flag de compilation
+    RollingTimes times;
+    assert(times.getStats().samples == 0);
+    for (int i = 1; i <= 100; ++i)
+        times.add(static_cast<float>(i));
+    ProfileStats stats = times.getStats();
+    assert(stats.samples == 100);
+    assert(stats.mean == 50.5f && stats.max == 100.0f && stats.p95 == 95.0f);
+    for (int i = 0; i < 200; ++i)
+        times.add(1.0f);
+    stats = times.getStats();
+    assert(stats.samples == RollingTimes::WINDOW);
+    assert(stats.mean == 1.0f && stats.max == 1.0f);
+
+    ECS::Manager manager;
+    auto *system = manager.addSystem<ProfiledSystem>();
+    Profiler::clear();
+
+    const int FRAMES = 10;
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        manager.update(1.0f / 60.0f);
+        manager.render(nullptr);
+        manager.refresh();
+    }
+    std::string json = trace();
+    assert(contains(json, "\"traceEvents\":["));
+
+#if ECS_ENABLE_PROFILER
+    // Systèmes (noms démanglés), Manager et scopes manuels
+    assert(system->getUpdateStats().samples == FRAMES);
+    assert(system->getRenderStats().samples == FRAMES);
+    assert(contains(json, "\"name\":\"ProfiledSystem::update\""));
+    assert(contains(json, "\"name\":\"ProfiledSystem::render\""));
+    assert(contains(json, "\"name\":\"ProfiledSystem::inner\""));
+    assert(contains(json, "\"name\":\"Manager::update\""));
+    assert(contains(json, "\"name\":\"Manager::refresh\""));
+    assert(contains(json, "\"ph\":\"X\""));
+
+    // Noms internés et échappés
+    const char *quoted = Profiler::internName("say \"hi\"\\");
+    assert(Profiler::internName("say \"hi\"\\") == quoted);
+    Profiler::clear();
+    {
+        ECS_PROFILE_SCOPE(quoted);
+    }
+    json = trace();
+    assert(contains(json, "\"name\":\"say \\\"hi\\\"\\\\\""));
+    assert(!contains(json, "Manager::update"));
+
+    // Suspendu: plus d'événements, les statistiques des systèmes continuent
+    Profiler::clear();
+    Profiler::setEnabled(false);
+    manager.update(1.0f / 60.0f);
+    assert(!contains(trace(), "\"name\""));
+    assert(system->getUpdateStats().samples == FRAMES + 1);
+    Profiler::setEnabled(true);
+    manager.update(1.0f / 60.0f);
+    assert(contains(trace(), "ProfiledSystem::update"));
+#else
+    // Aucune mesure, ni dans la trace ni dans les systèmes
+    assert(!contains(json, "\"name\""));
+    assert(system->getUpdateStats().samples == 0);
+    assert(system->getRenderStats().samples == 0);
+#endif
+
+    std::cout << "ProfilerTest: OK\n";
+    return 0;
+}
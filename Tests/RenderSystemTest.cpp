@@ -0,0 +1,76 @@
+/*
+ * Régression: RenderSystem doit suivre les modifications faites via
+ * getComponent (qui avance le tick), ex: scale ou srcRect, et ne réécrit
+ * pas les sprites inchangés.
+ *
+ * g++ -std=c++17 -I.. RenderSystemTest.cpp ../Systems/RenderSystem.cpp ../Systems/MovementSystem.cpp -o RenderSystemTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/SpriteComponent.h"
+#include "../Components/CameraComponent.h"
+#include "../Systems/RenderSystem.h"
+#include <cassert>
+#include <iostream>
+
+int main()
+{
+    ECS::Manager manager;
+    manager.addSystem<RenderSystem>();
+
+    auto &entity = manager.createEntity();
+    entity.addComponent<TransformComponent>(10.0f, 20.0f);
+    auto &sprite = entity.addComponent<SpriteComponent>();
+    sprite.srcRect = {0, 0, 16, 16};
+    manager.refresh();
+
+    manager.update(1.0f / 60.0f);
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.w == 16);
+
+    // Écritures directes: getComponent suffit à signaler la modification
+    entity.getComponent<TransformComponent>().scale = 2.0f;
+    manager.update(1.0f / 60.0f);
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.w == 32);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.h == 32);
+
+    entity.getComponent<SpriteComponent>().srcRect.w = 8;
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.w == 16);
+
+    entity.getComponent<TransformComponent>().teleport(50.0f, 60.0f);
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.x == 50);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.y == 60);
+
+    // Rien de modifié: dstRect n'est plus réécrit, le sprite n'est pas signalé modifié
+    manager.update(1.0f / 60.0f);
+    manager.render(nullptr);
+    std::uint32_t spriteTick = entity.getChangeTick<SpriteComponent>();
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        manager.update(1.0f / 60.0f);
+        manager.render(nullptr);
+    }
+    assert(entity.getChangeTick<SpriteComponent>() == spriteTick);
+
+    // setCamera retient l'entité: la caméra est retrouvée après un changement d'archetype
+    auto &cameraEntity = manager.createEntity();
+    cameraEntity.addComponent<CameraComponent>();
+    manager.getSystem<RenderSystem>()->setCamera(&cameraEntity.getComponent<CameraComponent>());
+    cameraEntity.addComponent<TransformComponent>();
+    cameraEntity.getComponent<CameraComponent>().position = Vector2D(30.0f, 40.0f);
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.x == 20);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.y == 20);
+
+    // Caméra détruite: retour à la ressource (absente ici, pas de décalage)
+    cameraEntity.destroy();
+    manager.refresh();
+    manager.render(nullptr);
+    assert(entity.getComponent<const SpriteComponent>().dstRect.x == 50);
+
+    std::cout << "RenderSystemTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Vérifie les ressources du Manager: création, accès, remplacement à la même
+ * adresse (les pointeurs obtenus restent valides), ancienne valeur détruite une
+ * fois, constructeur qui lève sans toucher l'ancienne, et suppression.
+ *
+ * g++ -std=c++17 -I.. ResourceTest.cpp -o ResourceTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+static int destroyed = 0;
+
+struct Settings
+{
+    std::string name;
+    int volume;
+
+    Settings(std::string n, int v) : name(std::move(n)), volume(v)
+    {
+        if (v < 0)
+            throw std::invalid_argument("volume");
+    }
+    Settings(Settings &&) = default;
+    ~Settings() { ++destroyed; }
+};
+
+struct Score
+{
+    int value = 0;
+};
+
+int main()
+{
+    ECS::Manager manager;
+    assert(!manager.hasResource<Settings>());
+    assert(manager.resource<Settings>() == nullptr);
+
+    Settings &created = manager.setResource<Settings>("default", 50);
+    Settings *settings = manager.resource<Settings>();
+    assert(settings == &created);
+    assert(settings->name == "default" && settings->volume == 50);
+
+    // Remplacement: même adresse, nouvelle valeur, ancienne détruite
+    destroyed = 0;
+    Settings &replaced = manager.setResource<Settings>("level2", 80);
+    assert(&replaced == settings);
+    assert(manager.resource<Settings>() == settings);
+    assert(settings->name == "level2" && settings->volume == 80);
+    assert(destroyed == 2); // Ancienne valeur + temporaire déplacé
+
+    // Constructeur qui lève: l'ancienne valeur reste en place
+    destroyed = 0;
+    bool threw = false;
+    try
+    {
+        manager.setResource<Settings>("broken", -1);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    assert(threw);
+    assert(destroyed == 0);
+    assert(manager.resource<Settings>() == settings);
+    assert(settings->name == "level2" && settings->volume == 80);
+
+    // Types indépendants, Managers indépendants
+    manager.setResource<Score>().value = 3;
+    assert(manager.resource<Score>()->value == 3);
+    ECS::Manager other;
+    assert(!other.hasResource<Score>());
+    other.setResource<Score>().value = 7;
+    assert(manager.resource<Score>()->value == 3);
+
+    // Suppression: la ressource disparaît, l'autre reste
+    destroyed = 0;
+    manager.removeResource<Settings>();
+    assert(destroyed == 1);
+    assert(!manager.hasResource<Settings>());
+    assert(manager.hasResource<Score>());
+    manager.setResource<Settings>("again", 10);
+    assert(manager.resource<Settings>()->name == "again");
+
+    std::cout << "ResourceTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Snapshots: aller-retour, fichiers tronqués ou corrompus, et callbacks
+ * utilisateur appelés pendant un chargement. Un chargement refusé ne
+ * déclenche ni init() ni observers Added.
+ *
+ * g++ -std=c++17 -I.. SnapshotTest.cpp -o SnapshotTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/ComponentSerialization.h"
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+struct Score : ECS::Component
+{
+    int value = 0;
+};
+
+int initCalls = 0;
+
+struct Counted : ECS::Component
+{
+    int value = 0;
+    void init() override { ++initCalls; }
+};
+
+// Serializer Custom qui lit plus qu'il n'écrit: échoue en cours de chargement
+struct Broken : ECS::Component
+{
+    int value = 0;
+};
+
+int main()
+{
+    registerEngineComponents();
+
+    ECS::Manager world;
+    for (int i = 0; i < 50; ++i)
+    {
+        auto &entity = world.createEntity();
+        entity.addComponent<TransformComponent>(static_cast<float>(i), 2.0f * i);
+        auto &animation = entity.addComponent<AnimationComponent>();
+        animation.animations["Walk"] = Animation(1, 8, 80, false);
+    }
+    world.refresh();
+
+    std::vector<std::uint8_t> snapshot;
+    world.saveSnapshot(snapshot);
+
+    // Aller-retour, champs Raw et Custom
+    ECS::Manager loaded;
+    assert(loaded.loadSnapshot(snapshot));
+    assert(loaded.getEntities().size() == 50);
+    for (ECS::Entity *entity : loaded.getEntities())
+    {
+        const auto &transform = entity->getComponent<TransformComponent>();
+        assert(transform.position.y == 2.0f * transform.position.x);
+        const Animation &walk = entity->getComponent<AnimationComponent>().animations.at("Walk");
+        assert(walk.index == 1 && walk.frames == 8 && walk.speed == 80 && !walk.loop);
+    }
+
+    // Snapshot tronqué: refusé avant de toucher au monde, qui reste intact
+    for (std::size_t cut : {snapshot.size() / 2, snapshot.size() - 1})
+    {
+        ECS::Manager partial;
+        partial.createEntity();
+        partial.refresh();
+        std::vector<std::uint8_t> truncated(snapshot.begin(), snapshot.begin() + cut);
+        assert(!partial.loadSnapshot(truncated));
+        assert(partial.getEntities().size() == 1);
+    }
+
+    // Nombre de composants absurde juste après l'en-tête: refusé sans allouer
+    {
+        std::vector<std::uint8_t> corrupt(snapshot);
+        std::uint32_t huge = 0xFFFFFFF0u;
+        std::memcpy(corrupt.data() + 2 * sizeof(std::uint32_t), &huge, sizeof(huge));
+        ECS::Manager target;
+        assert(!target.loadSnapshot(corrupt));
+    }
+
+    // Un observer appelé pendant le chargement peut enregistrer un composant
+    // (le registre n'est pas verrouillé pendant les callbacks)
+    {
+        ECS::Manager target;
+        target.createEntity().addComponent<TransformComponent>();
+        target.refresh();
+        bool registered = false;
+        target.observe<TransformComponent>(ECS::ComponentEvent::Removed, [&](const std::vector<ECS::EntityHandle> &)
+                                           {
+                                               ECS::registerComponent<Score>("Score", &Score::value);
+                                               registered = true; });
+        assert(target.loadSnapshot(snapshot));
+        assert(registered);
+    }
+
+    // Chargement refusé: aucun init(), aucun Added, aucune entité dans les systèmes
+    ECS::registerComponent<Counted>("Counted", &Counted::value);
+    ECS::registerComponent<Broken>(
+        "Broken",
+        [](const Broken &, BinaryWriter &) {},
+        [](Broken &broken, BinaryReader &in)
+        { broken.value = in.read<int>(); });
+    {
+        ECS::Manager source;
+        for (int i = 0; i < 4; ++i)
+        {
+            auto &entity = source.createEntity();
+            entity.addComponent<Counted>();
+            if (i == 3)
+            {
+                entity.addComponent<Broken>(); // Archetype écrit après celui de Counted seul
+            }
+        }
+        source.refresh();
+        std::vector<std::uint8_t> broken;
+        source.saveSnapshot(broken);
+
+        struct Watcher : ECS::System
+        {
+            Watcher() { requireComponent<Counted>(); }
+        };
+
+        for (bool truncate : {true, false})
+        {
+            ECS::Manager target;
+            target.addSystem<Watcher>();
+            std::size_t added = 0;
+            target.observe<Counted>(ECS::ComponentEvent::Added, [&](const std::vector<ECS::EntityHandle> &handles)
+                                    { added += handles.size(); });
+            std::vector<std::uint8_t> data(broken.begin(), broken.end() - (truncate ? 1 : 0));
+
+            initCalls = 0;
+            assert(!target.loadSnapshot(data));
+            target.update(1.0f / 60.0f);
+            target.refresh();
+            assert(initCalls == 0);
+            assert(added == 0);
+            assert(target.getEntities().empty());
+            assert(target.getSystem<Watcher>()->getEntities().empty());
+        }
+    }
+
+    std::cout << "SnapshotTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Régression: une exception levée par un système exécuté sur le pool de threads
+ * remonte à l'appelant de update() après la fin de toutes les tâches (pas de
+ * std::terminate, pas de tâche qui survit à la frame). Les systèmes qui
+ * dépendent de celui qui a levé sont sautés, et le Manager reste utilisable.
+ * Même chose pour parallelEach. À lancer aussi avec -fsanitize=thread.
+ *
+ * g++ -std=c++17 -I.. SystemExceptionTest.cpp -o SystemExceptionTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+struct B : ECS::Component
+{
+    int value = 0;
+};
+
+struct C : ECS::Component
+{
+};
+
+std::atomic<bool> shouldThrow{false};
+std::atomic<int> throwerRuns{0};
+std::atomic<int> dependentRuns{0};
+
+struct Thrower : ECS::System
+{
+    Thrower() { requireComponent<B>(); }
+
+    void update(float) override
+    {
+        ++throwerRuns;
+        if (shouldThrow)
+        {
+            throw std::runtime_error("system failure");
+        }
+    }
+};
+
+// Lit B: attend Thrower
+struct Dependent : ECS::System
+{
+    Dependent() { requireComponent<B>(ECS::Access::Read); }
+
+    void update(float) override { ++dependentRuns; }
+};
+
+static bool updateThrows(ECS::Manager &manager)
+{
+    try
+    {
+        manager.update(0.0f);
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    ECS::Manager manager;
+    manager.setThreadCount(4);
+    manager.addSystem<Thrower>();
+    manager.addSystem<Dependent>();
+    for (int i = 0; i < 10000; ++i)
+    {
+        manager.createEntity().addComponent<B>();
+    }
+    manager.refresh();
+
+    manager.update(0.0f);
+    assert(throwerRuns == 1 && dependentRuns == 1);
+
+    // Le système lève: l'exception remonte, le dépendant est sauté
+    shouldThrow = true;
+    assert(updateThrows(manager));
+    assert(throwerRuns == 2 && dependentRuns == 1);
+
+    // Frame suivante normale
+    shouldThrow = false;
+    manager.update(0.0f);
+    assert(throwerRuns == 3 && dependentRuns == 2);
+
+    // parallelEach: les autres lots finissent, puis l'exception remonte
+    std::atomic<int> visited{0};
+    bool threw = false;
+    try
+    {
+        manager.view<B>().parallelEach([&](B &b)
+                                       {
+                                           ++visited;
+                                           if (b.value++ == 0 && visited == 1)
+                                           {
+                                               throw std::runtime_error("batch failure");
+                                           }
+                                       },
+                                       64, 0);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    assert(threw);
+    assert(visited > 0);
+
+    visited = 0;
+    manager.view<B>().parallelEach([&](B &) { ++visited; }, 64, 0);
+    assert(visited == 10000);
+
+    std::cout << "SystemExceptionTest: OK\n";
+    return 0;
+}
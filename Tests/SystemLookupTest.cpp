@@ -0,0 +1,78 @@
+/*
+ * Régression: getSystem<T>() appelé depuis des update() parallèles donne le
+ * même résultat qu'en séquentiel, même pour un type jamais demandé avant (ex:
+ * une classe de base): l'entrée du cache est créée sous verrou, les entrées
+ * existantes sont remises à jour entre les frames quand des systèmes sont
+ * ajoutés/retirés.
+ * À lancer aussi avec -fsanitize=thread.
+ *
+ * g++ -std=c++17 -I.. SystemLookupTest.cpp -o SystemLookupTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+
+struct TargetBase : ECS::System
+{
+};
+
+struct Target : TargetBase
+{
+};
+
+std::atomic<int> found{0};
+std::atomic<int> missing{0};
+
+template <int I>
+struct Lookup : ECS::System
+{
+    void update(float) override
+    {
+        // TargetBase: jamais demandé hors des update() parallèles
+        bool base = manager->getSystem<TargetBase>() != nullptr;
+        if (manager->getSystem<Target>())
+        {
+            assert(base);
+            ++found;
+        }
+        else
+        {
+            assert(!base);
+            ++missing;
+        }
+    }
+};
+
+int main()
+{
+    ECS::Manager manager;
+    manager.setThreadCount(4);
+    manager.addSystem<Lookup<0>>();
+    manager.addSystem<Lookup<1>>();
+    manager.addSystem<Lookup<2>>();
+    manager.addSystem<Lookup<3>>();
+
+    const int FRAMES = 2000;
+    int expectedFound = 0;
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        // Target ajouté/retiré une frame sur deux: la version du cache change à chaque frame
+        bool present = frame % 2 == 0;
+        if (present)
+        {
+            manager.addSystem<Target>();
+            expectedFound += 4;
+        }
+        manager.update(1.0f / 60.0f);
+        if (present)
+        {
+            assert(manager.removeSystem<Target>());
+        }
+        assert(found == expectedFound);
+        assert(found + missing == (frame + 1) * 4);
+    }
+
+    std::cout << "SystemLookupTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Régression: setPriority() appelé pendant un update() ne doit ni sauter ni
+ * relancer de système; le nouvel ordre s'applique à la frame suivante.
+ * Hors update(), getSystems voit tout de suite le nouvel ordre, et les
+ * contraintes runAfter restent respectées.
+ *
+ * g++ -std=c++17 -I.. SystemPriorityTest.cpp -o SystemPriorityTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+#include <string>
+
+std::string order;
+
+struct First : ECS::System
+{
+    void update(float) override
+    {
+        order += 'A';
+        setPriority(10); // Passe après Second
+    }
+};
+
+struct Second : ECS::System
+{
+    Second() { priority = 5; }
+    void update(float) override { order += 'B'; }
+};
+
+struct Third : ECS::System
+{
+    Third() { priority = 7; }
+    void update(float) override { order += 'C'; }
+};
+
+struct Fourth : ECS::System
+{
+    Fourth() { runAfter<Third>(); }
+    void update(float) override { order += 'D'; }
+};
+
+static std::string currentOrder(ECS::Manager &manager)
+{
+    std::string result;
+    for (ECS::System *system : manager.getSystems<ECS::System>())
+    {
+        result += dynamic_cast<First *>(system)    ? 'A'
+                  : dynamic_cast<Second *>(system) ? 'B'
+                  : dynamic_cast<Third *>(system)  ? 'C'
+                                                   : 'D';
+    }
+    return result;
+}
+
+int main()
+{
+    ECS::Manager manager;
+    manager.addSystem<First>();
+    manager.addSystem<Second>();
+    manager.addSystem<Third>();
+
+    manager.update(1.0f / 60.0f);
+    assert(order == "ABC");
+
+    order.clear();
+    manager.update(1.0f / 60.0f);
+    assert(order == "BCA");
+
+    // Hors update(): visible immédiatement par getSystems
+    manager.getSystem<Second>()->setPriority(20);
+    assert(currentOrder(manager) == "CAB");
+
+    // Fourth (priorité 0) doit suivre Third, même quand Third passe derrière tout le monde
+    manager.addSystem<Fourth>();
+    assert(currentOrder(manager) == "CDAB");
+    manager.getSystem<Third>()->setPriority(30);
+    assert(currentOrder(manager) == "ABCD");
+
+    // Et Fourth ne peut pas passer devant Third en baissant sa priorité
+    manager.getSystem<Fourth>()->setPriority(-5);
+    assert(currentOrder(manager) == "ABCD");
+
+    order.clear();
+    manager.update(1.0f / 60.0f);
+    assert(order == "ABCD");
+
+    std::cout << "SystemPriorityTest: OK\n";
+    return 0;
+}
@@ -0,0 +1,38 @@
+/*
+ * Régression: les requêtes par chaîne (hasTag, getEntitiesByTag...) n'internent
+ * pas les tags inconnus, et setTag/getTagID continuent de les créer.
+ *
+ * g++ -std=c++17 -I.. TagLookupTest.cpp -o TagLookupTest -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+
+int main()
+{
+    ECS::Manager manager;
+    auto &player = manager.createEntity("Player");
+    auto &untagged = manager.createEntity();
+
+    assert(player.hasTag("Player"));
+    assert(!player.hasTag("Ghost"));
+    assert(untagged.hasTag(""));
+    assert(!untagged.hasTag("Ghost"));
+    assert(manager.getEntityByTag("Ghost") == nullptr);
+    assert(manager.getEntitiesByTag("Ghost").empty());
+    assert(manager.getEntityByTag("Player") == &player);
+
+    // Aucune de ces lectures n'a interné "Ghost"
+    assert(ECS::findTagID("Ghost") == ECS::INVALID_TAG);
+    assert(ECS::getTagName(ECS::INVALID_TAG).empty());
+    assert(!player.hasTag(ECS::findTagID("Ghost")));
+
+    // L'écriture interne le tag
+    untagged.setTag("Ghost");
+    ECS::TagID ghost = ECS::findTagID("Ghost");
+    assert(ghost != ECS::INVALID_TAG && ghost == ECS::getTagID("Ghost"));
+    assert(manager.getEntityByTag(ghost) == &untagged);
+
+    std::cout << "TagLookupTest: OK\n";
+    return 0;
+}
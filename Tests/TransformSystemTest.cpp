@@ -0,0 +1,97 @@
+/*
+ * Régression: un enfant suit son parent déplacé via getComponent, seuls les
+ * sous-arbres sales sont recalculés (les autres transforms ne sont pas signalés
+ * modifiés), et TransformSystem passe après MovementSystem quel que soit
+ * l'ordre d'ajout.
+ *
+ * g++ -std=c++17 -I.. TransformSystemTest.cpp ../Systems/TransformSystem.cpp ../Systems/MovementSystem.cpp -o TransformSystemTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include "../Components/TransformComponent.h"
+#include "../Components/HierarchyComponent.h"
+#include "../Systems/TransformSystem.h"
+#include "../Systems/MovementSystem.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+static bool near(const Vector2D &a, float x, float y)
+{
+    return std::fabs(a.x - x) < 0.01f && std::fabs(a.y - y) < 0.01f;
+}
+
+int main()
+{
+    const float STEP = 1.0f / MovementSystem::UPDATE_RATE;
+
+    ECS::Manager manager;
+    manager.addSystem<TransformSystem>(MovementSystem::UPDATE_RATE); // Ajouté avant MovementSystem, sans priorité
+    manager.addSystem<MovementSystem>(MovementSystem::UPDATE_RATE);
+    assert(manager.getSystems<ECS::System>()[0] == manager.getSystem<MovementSystem>());
+
+    auto &parent = manager.createEntity();
+    parent.addComponent<TransformComponent>(100.0f, 100.0f);
+    auto &child = manager.createEntity();
+    child.addComponent<TransformComponent>();
+    child.addComponent<HierarchyComponent>(parent.getHandle(), 5.0f, 0.0f);
+    manager.refresh();
+
+    manager.update(STEP);
+    assert(near(child.getComponent<const TransformComponent>().position, 105.0f, 100.0f));
+
+    // Déplacement du parent (racine comparée par valeur)
+    parent.getComponent<TransformComponent>().teleport(200.0f, 200.0f);
+    manager.update(STEP);
+    assert(near(child.getComponent<const TransformComponent>().position, 205.0f, 200.0f));
+
+    // Changement de décalage local signalé
+    child.patchComponent<HierarchyComponent>().localPosition = Vector2D(0.0f, 10.0f);
+    manager.update(STEP);
+    assert(near(child.getComponent<const TransformComponent>().position, 200.0f, 210.0f));
+
+    // Second arbre, immobile: ni recalculé ni réécrit quand le premier bouge
+    auto &other = manager.createEntity();
+    other.addComponent<TransformComponent>(-50.0f, -50.0f);
+    auto &otherChild = manager.createEntity();
+    otherChild.addComponent<TransformComponent>();
+    otherChild.addComponent<HierarchyComponent>(other.getHandle(), 1.0f, 0.0f);
+    auto &grandChild = manager.createEntity();
+    grandChild.addComponent<TransformComponent>();
+    grandChild.addComponent<HierarchyComponent>(otherChild.getHandle(), 1.0f, 0.0f);
+    manager.refresh();
+    manager.update(STEP);
+    assert(near(grandChild.getComponent<const TransformComponent>().position, -48.0f, -50.0f));
+
+    // Écriture interdite (cache de l'enfant): ne serait écrasée que par un recalcul
+    grandChild.getComponent<TransformComponent>().teleport(999.0f, 999.0f);
+    std::uint32_t otherTick = otherChild.getChangeTick<TransformComponent>();
+    std::uint32_t grandTick = grandChild.getChangeTick<TransformComponent>();
+
+    parent.getComponent<TransformComponent>().teleport(300.0f, 300.0f);
+    manager.update(STEP);
+    assert(near(child.getComponent<const TransformComponent>().position, 300.0f, 310.0f));
+    assert(otherChild.getChangeTick<TransformComponent>() == otherTick);
+    assert(grandChild.getChangeTick<TransformComponent>() == grandTick);
+    assert(near(grandChild.getComponent<const TransformComponent>().position, 999.0f, 999.0f));
+
+    // Sous-arbre interne sale: seul lui est recalculé, à partir du cache de son parent
+    otherChild.patchComponent<HierarchyComponent>().localPosition = Vector2D(0.0f, 2.0f);
+    manager.update(STEP);
+    assert(near(otherChild.getComponent<const TransformComponent>().position, -50.0f, -48.0f));
+    assert(near(grandChild.getComponent<const TransformComponent>().position, -49.0f, -48.0f));
+
+    // Changement de parent signalé: le petit-enfant suit son nouveau parent
+    grandChild.patchComponent<HierarchyComponent>().parent = parent.getHandle();
+    manager.update(STEP);
+    assert(near(grandChild.getComponent<const TransformComponent>().position, 301.0f, 300.0f));
+
+    // Vitesse appliquée par MovementSystem: l'enfant la suit pendant le même pas
+    parent.getComponent<TransformComponent>().velocity = Vector2D(60.0f, 0.0f);
+    manager.update(STEP);
+    float parentX = parent.getComponent<const TransformComponent>().position.x;
+    assert(parentX > 300.0f);
+    assert(near(child.getComponent<const TransformComponent>().position, parentX, 310.0f));
+
+    std::cout << "TransformSystemTest: OK\n";
+    return 0;
+}
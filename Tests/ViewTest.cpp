@@ -0,0 +1,104 @@
+/*
+ * Vérifie view<Ts...>(): each (avec et sans Entity&), eachChunk, size/empty,
+ * parcours de plusieurs archetypes et de plusieurs chunks, et le cache des
+ * requêtes complété quand un archetype correspondant apparaît après coup.
+ *
+ * g++ -std=c++17 -I.. ViewTest.cpp -o ViewTest -lSDL2 -pthread
+ */
+#include "../ECS.h"
+#include <cassert>
+#include <iostream>
+
+struct Position : ECS::Component
+{
+    int x = 0;
+    Position() = default;
+    explicit Position(int value) : x(value) {}
+};
+
+struct Velocity : ECS::Component
+{
+    int x = 1;
+};
+
+struct Marker : ECS::Component
+{
+};
+
+int main()
+{
+    ECS::Manager manager;
+
+    // Vue créée avant toute entité: vide, puis remplie par les archetypes suivants
+    assert((manager.view<Position, Velocity>().empty()));
+
+    // Assez d'entités pour remplir plusieurs chunks
+    const int COUNT = 5000;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        auto &entity = manager.createEntity();
+        entity.addComponent<Position>(i);
+        entity.addComponent<Velocity>();
+    }
+    // Archetype sans Velocity: ignoré par la vue
+    manager.createEntity().addComponent<Position>(-1);
+    manager.refresh();
+
+    auto view = manager.view<Position, Velocity>();
+    assert(view.size() == static_cast<std::size_t>(COUNT));
+    assert(!view.empty());
+
+    long long sum = 0;
+    view.each([&](const Position &position, const Velocity &) { sum += position.x; });
+    assert(sum == static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+
+    // Écriture via la vue, l'entité reçue est bien celle de la ligne
+    view.each([](Position &position, const Velocity &velocity) { position.x += velocity.x; });
+    int mismatches = 0;
+    view.each([&](ECS::Entity &entity, const Position &position, const Velocity &)
+              {
+                  if (&entity.getComponent<const Position>() != &position)
+                      ++mismatches;
+              });
+    assert(mismatches == 0);
+
+    // eachChunk: tableaux contigus, plusieurs chunks, même total
+    std::size_t chunks = 0;
+    std::size_t rows = 0;
+    sum = 0;
+    view.eachChunk([&](std::size_t count, const Position *positions, const Velocity *)
+                   {
+                       ++chunks;
+                       rows += count;
+                       for (std::size_t i = 0; i < count; ++i)
+                           sum += positions[i].x;
+                   });
+    assert(chunks > 1);
+    assert(rows == static_cast<std::size_t>(COUNT));
+    assert(sum == static_cast<long long>(COUNT) * (COUNT + 1) / 2);
+
+    // Nouvel archetype correspondant (avec Marker): le cache de la requête le reprend
+    std::size_t cachedBefore = manager.view<Position>().size();
+    auto &late = manager.createEntity();
+    late.addComponent<Position>(100000);
+    late.addComponent<Velocity>();
+    late.addComponent<Marker>();
+    manager.refresh();
+    assert((manager.view<Position, Velocity>().size() == static_cast<std::size_t>(COUNT + 1)));
+    assert((manager.view<Position>().size() == cachedBefore + 1));
+    assert((manager.view<Marker, Position>().size() == 1));
+
+    bool seenLate = false;
+    manager.view<Position, Velocity>().each([&](ECS::Entity &entity, Position &, Velocity &)
+                                             { seenLate = seenLate || &entity == &late; });
+    assert(seenLate);
+
+    // Composant retiré: l'entité quitte la vue
+    late.removeComponent<Velocity>();
+    manager.refresh();
+    assert((manager.view<Position, Velocity>().size() == static_cast<std::size_t>(COUNT)));
+    assert((manager.view<Marker, Position>().size() == 1));
+
+    std::cout << "ViewTest: OK\n";
+    return 0;
+}
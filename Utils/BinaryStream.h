@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+ * ============================================================================
+ * BinaryWriter / BinaryReader - Flux binaires en mémoire
+ * ============================================================================
+ * Utilisés par les snapshots du Manager (voir ECS::registerComponent) pour
+ * écrire les composants qui ne peuvent pas être copiés tels quels
+ * (std::string, std::map, textures...).
+ *
+ * Les valeurs sont écrites brutes, dans l'ordre de la machine: un snapshot
+ * se relit avec le même build du jeu, pas forcément sur une autre plateforme.
+ *
+ * Le lecteur ne lit jamais au-delà du buffer: une lecture trop longue met
+ * le flux en échec (voir failed()) et retourne des zéros.
+ *
+ * Usage:
+ *   std::vector<std::uint8_t> buffer;
+ *   BinaryWriter writer(buffer);
+ *   writer.write(42);
+ *   writer.writeString("Idle");
+ *
+ *   BinaryReader reader(buffer.data(), buffer.size());
+ *   int value = reader.read<int>();
+ *   std::string name = reader.readString();
+ * ============================================================================
+ */
+
+class BinaryWriter
+{
+private:
+    std::vector<std::uint8_t> &buffer;
+
+public:
+    explicit BinaryWriter(std::vector<std::uint8_t> &output) : buffer(output) {}
+
+    void writeBytes(const void *data, std::size_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        std::size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        std::memcpy(buffer.data() + offset, data, size);
+    }
+
+    template <typename T>
+    void write(const T &value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "write(): type non copiable tel quel, écrire ses champs un par un");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeString(const std::string &value)
+    {
+        write(static_cast<std::uint32_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
+    // Réserve size octets à remplir directement (évite une copie intermédiaire)
+    std::uint8_t *allocate(std::size_t size)
+    {
+        std::size_t offset = buffer.size();
+        buffer.resize(offset + size);
+        return buffer.data() + offset;
+    }
+
+    void reserve(std::size_t size) { buffer.reserve(buffer.size() + size); }
+    std::size_t size() const { return buffer.size(); }
+};
+
+class BinaryReader
+{
+private:
+    const std::uint8_t *data;
+    std::size_t length;
+    std::size_t position = 0;
+    bool error = false;
+
+public:
+    BinaryReader(const std::uint8_t *bytes, std::size_t size) : data(bytes), length(size) {}
+
+    void readBytes(void *output, std::size_t size)
+    {
+        if (const std::uint8_t *bytes = consume(size))
+        {
+            std::memcpy(output, bytes, size);
+        }
+        else if (size > 0)
+        {
+            std::memset(output, 0, size);
+        }
+    }
+
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "read(): type non copiable tel quel, lire ses champs un par un");
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    std::string readString()
+    {
+        std::uint32_t size = read<std::uint32_t>();
+        const std::uint8_t *bytes = consume(size);
+        return bytes ? std::string(reinterpret_cast<const char *>(bytes), size) : std::string();
+    }
+
+    /*
+     * Avance de size octets et retourne leur adresse dans le buffer
+     * (nullptr et échec si le buffer est trop court)
+     */
+    const std::uint8_t *consume(std::size_t size)
+    {
+        if (error || size > length - position)
+        {
+            error = true;
+            return nullptr;
+        }
+        const std::uint8_t *bytes = data + position;
+        position += size;
+        return bytes;
+    }
+
+    bool failed() const { return error; }
+    std::size_t remaining() const { return length - position; }
+};
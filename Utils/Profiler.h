@@ -0,0 +1,330 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+/*
+ * ============================================================================
+ * Profiler - Chronomètres par scope, exportables en trace Chrome
+ * ============================================================================
+ * Chaque thread écrit ses mesures dans son propre buffer circulaire (pas de
+ * verrou pendant la frame): seules les ECS_PROFILER_BUFFER_SIZE dernières
+ * mesures de chaque thread sont gardées.
+ *
+ * Le Manager mesure déjà update(), render(), refresh(), updateSystemEntities()
+ * et chaque système (voir aussi System::getUpdateStats).
+ *
+ * Désactivation complète à la compilation: -DECS_ENABLE_PROFILER=0
+ * (les macros ne génèrent alors aucun code)
+ *
+ * Usage:
+ *   void AISystem::update(float deltaTime) {
+ *       ECS_PROFILE_SCOPE("AISystem::pathfinding");
+ *       ...
+ *   }
+ *
+ *   // Entre deux frames (pas pendant update()):
+ *   Profiler::writeChromeTrace("frame.json"); // chrome://tracing ou Perfetto
+ * ============================================================================
+ */
+
+#ifndef ECS_ENABLE_PROFILER
+#define ECS_ENABLE_PROFILER 1
+#endif
+
+#ifndef ECS_PROFILER_BUFFER_SIZE
+#define ECS_PROFILER_BUFFER_SIZE 65536 // Mesures gardées par thread
+#endif
+
+/*
+ * Statistiques glissantes d'une mesure répétée (en millisecondes)
+ */
+struct ProfileStats
+{
+    float mean = 0.0f;
+    float p95 = 0.0f;
+    float max = 0.0f;
+    std::size_t samples = 0;
+};
+
+/*
+ * Les WINDOW dernières durées d'une mesure (ex: l'update d'un système)
+ * Un seul thread écrit à la fois (celui qui exécute le système)
+ */
+class RollingTimes
+{
+public:
+    static constexpr std::size_t WINDOW = 120; // ~2 secondes à 60 FPS
+
+private:
+    float times[WINDOW] = {};
+    std::size_t count = 0;
+    std::size_t next = 0;
+
+public:
+    void add(float milliseconds)
+    {
+        times[next] = milliseconds;
+        next = (next + 1) % WINDOW;
+        count = std::min(count + 1, WINDOW);
+    }
+
+    ProfileStats getStats() const
+    {
+        ProfileStats stats;
+        stats.samples = count;
+        if (count == 0)
+        {
+            return stats;
+        }
+
+        float sorted[WINDOW];
+        std::copy(times, times + count, sorted);
+        float total = 0.0f;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            total += sorted[i];
+            stats.max = std::max(stats.max, sorted[i]);
+        }
+        stats.mean = total / static_cast<float>(count);
+
+        std::size_t rank = (count * 95 + 99) / 100 - 1; // Plus petite valeur >= 95% des mesures
+        std::nth_element(sorted, sorted + rank, sorted + count);
+        stats.p95 = sorted[rank];
+        return stats;
+    }
+
+    void clear() { count = next = 0; }
+};
+
+class Profiler
+{
+public:
+    struct Event
+    {
+        const char *name;    // Chaîne statique ou internée (voir internName)
+        std::uint64_t start; // Nanosecondes depuis le démarrage du profiler
+        std::uint64_t end;
+    };
+
+private:
+    struct ThreadBuffer
+    {
+        std::vector<Event> events;
+        std::atomic<std::size_t> written{0}; // Total écrit (index = written % taille)
+        std::uint32_t threadID;
+
+        explicit ThreadBuffer(std::uint32_t id) : events(ECS_PROFILER_BUFFER_SIZE), threadID(id) {}
+    };
+
+    struct State
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers; // Survivent à leur thread
+        std::deque<std::string> names;                      // deque: c_str() stables
+        std::atomic<bool> enabled{true};
+        std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    };
+
+    static State &state()
+    {
+        static State instance;
+        return instance;
+    }
+
+    static ThreadBuffer &threadBuffer()
+    {
+        static thread_local ThreadBuffer *buffer = nullptr;
+        if (!buffer)
+        {
+            State &s = state();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(s.buffers.size())));
+            buffer = s.buffers.back().get();
+        }
+        return *buffer;
+    }
+
+    static void writeEscaped(std::ostream &out, const char *text)
+    {
+        for (; *text; ++text)
+        {
+            char c = *text;
+            if (c == '"' || c == '\\')
+            {
+                out << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) >= 0x20)
+            {
+                out << c;
+            }
+        }
+    }
+
+public:
+    static std::uint64_t now()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now() - state().epoch)
+                                              .count());
+    }
+
+    static void record(const char *name, std::uint64_t start, std::uint64_t end)
+    {
+        if (!state().enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        ThreadBuffer &buffer = threadBuffer();
+        std::size_t index = buffer.written.load(std::memory_order_relaxed);
+        buffer.events[index % buffer.events.size()] = {name, start, end};
+        buffer.written.store(index + 1, std::memory_order_release);
+    }
+
+    // Suspend/reprend l'enregistrement (les statistiques des systèmes continuent)
+    static void setEnabled(bool enabled) { state().enabled = enabled; }
+    static bool isEnabled() { return state().enabled; }
+
+    /*
+     * Copie name dans une table jamais libérée: le pointeur reste valide
+     * même après la destruction de l'objet qui l'a fourni
+     */
+    static const char *internName(const std::string &name)
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto it = std::find(s.names.begin(), s.names.end(), name);
+        if (it != s.names.end())
+        {
+            return it->c_str();
+        }
+        s.names.push_back(name);
+        return s.names.back().c_str();
+    }
+
+    // Nom lisible d'un type (typeid(T).name() est décoré sous GCC/Clang)
+    static std::string typeName(const char *mangled)
+    {
+#if defined(__GNUC__)
+        int status = 0;
+        char *demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+        if (status == 0 && demangled)
+        {
+            std::string name(demangled);
+            std::free(demangled);
+            return name;
+        }
+#endif
+        std::string name(mangled);
+        for (const char *prefix : {"class ", "struct "})
+        {
+            if (name.compare(0, std::char_traits<char>::length(prefix), prefix) == 0)
+            {
+                return name.substr(std::char_traits<char>::length(prefix));
+            }
+        }
+        return name;
+    }
+
+    // Oublie toutes les mesures enregistrées
+    static void clear()
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (auto &buffer : s.buffers)
+        {
+            buffer->written = 0;
+        }
+    }
+
+    /*
+     * Écrit les mesures au format trace_event de Chrome (chrome://tracing, Perfetto)
+     * À appeler quand aucun thread ne mesure (entre deux frames)
+     */
+    static void writeChromeTrace(std::ostream &out)
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        for (const auto &buffer : s.buffers)
+        {
+            std::size_t written = buffer->written.load(std::memory_order_acquire);
+            std::size_t size = buffer->events.size();
+            std::size_t begin = written > size ? written - size : 0;
+
+            for (std::size_t i = begin; i < written; ++i)
+            {
+                const Event &event = buffer->events[i % size];
+                out << (first ? "\n" : ",\n") << "{\"name\":\"";
+                writeEscaped(out, event.name);
+                // Durées en microsecondes (avec décimales: précision à la nanoseconde)
+                out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadID
+                    << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+                    << ",\"dur\":" << static_cast<double>(event.end - event.start) / 1000.0 << "}";
+                first = false;
+            }
+        }
+        out << "\n]}\n";
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    static bool writeChromeTrace(const std::string &path)
+    {
+        std::ofstream file(path);
+        writeChromeTrace(file);
+        return static_cast<bool>(file);
+    }
+};
+
+/*
+ * Mesure la durée de vie du scope (voir ECS_PROFILE_SCOPE)
+ */
+class ProfileScope
+{
+private:
+    const char *name;
+    std::uint64_t start;
+
+public:
+    explicit ProfileScope(const char *scopeName) : name(scopeName), start(Profiler::now()) {}
+    ~ProfileScope() { Profiler::record(name, start, Profiler::now()); }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+};
+
+#define ECS_PROFILE_CONCAT_(a, b) a##b
+#define ECS_PROFILE_CONCAT(a, b) ECS_PROFILE_CONCAT_(a, b)
+
+#if ECS_ENABLE_PROFILER
+// name: chaîne littérale (ou internée par Profiler::internName)
+#define ECS_PROFILE_SCOPE(name) ProfileScope ECS_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define ECS_PROFILE_FUNCTION() ECS_PROFILE_SCOPE(__func__)
+#else
+#define ECS_PROFILE_SCOPE(name) ((void)0)
+#define ECS_PROFILE_FUNCTION() ((void)0)
+#endif
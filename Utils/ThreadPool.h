@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * ============================================================================
+ * ThreadPool - Pool de threads à vol de tâches (work stealing)
+ * ============================================================================
+ * Chaque worker a sa propre file: il dépile ses tâches par la fin (les plus
+ * récentes, encore chaudes en cache) et, quand elle est vide, vole les plus
+ * anciennes au début de la file d'un autre worker.
+ *
+ * Le thread qui attend (wait) exécute lui aussi des tâches au lieu de dormir.
+ *
+ * Usage:
+ *   ThreadPool pool(4);
+ *   std::atomic<std::size_t> pending{2};
+ *   pool.submit([&] { doA(); pending--; });
+ *   pool.submit([&] { doB(); pending--; });
+ *   pool.wait(pending);
+ * ============================================================================
+ */
+
+class ThreadPool
+{
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; // Une file par worker
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::atomic<std::size_t> queuedTasks{0};
+    std::atomic<std::size_t> nextQueue{0};
+    std::atomic<bool> stopping{false};
+
+    // Index du worker courant (-1 pour un thread extérieur au pool)
+    static std::size_t &currentWorkerIndex()
+    {
+        static thread_local std::size_t index = static_cast<std::size_t>(-1);
+        return index;
+    }
+
+    bool popTask(std::size_t index, std::function<void()> &task)
+    {
+        // Sa propre file d'abord, par la fin
+        if (index < queues.size())
+        {
+            WorkQueue &queue = *queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                queuedTasks--;
+                return true;
+            }
+        }
+
+        // Puis vol au début des files des autres workers
+        for (std::size_t offset = 1; offset <= queues.size(); ++offset)
+        {
+            WorkQueue &victim = *queues[(index + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queuedTasks--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(std::size_t index)
+    {
+        currentWorkerIndex() = index;
+
+        std::function<void()> task;
+        while (true)
+        {
+            if (popTask(index, task))
+            {
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]
+                        { return queuedTasks.load() > 0 || stopping.load(); });
+
+            if (stopping.load() && queuedTasks.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency())
+    {
+        if (threadCount == 0)
+        {
+            threadCount = 1;
+        }
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers.emplace_back([this, i]
+                                 { workerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /*
+     * Ajoute une tâche: dans la file du worker courant si on est dans le pool,
+     * sinon réparties à tour de rôle
+     */
+    void submit(std::function<void()> task)
+    {
+        std::size_t index = currentWorkerIndex();
+        if (index >= queues.size())
+        {
+            index = nextQueue++ % queues.size();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(task));
+            queuedTasks++;
+        }
+
+        {
+            // Verrou vide: évite qu'un worker rate la notification entre son test et son wait
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_one();
+    }
+
+    /*
+     * Attend que pending tombe à 0 en exécutant des tâches en attendant
+     */
+    void wait(const std::atomic<std::size_t> &pending)
+    {
+        std::size_t index = currentWorkerIndex();
+        std::function<void()> task;
+
+        while (pending.load(std::memory_order_acquire) > 0)
+        {
+            if (popTask(index, task))
+            {
+                task();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /*
+     * Découpe [0, count) en lots de grainSize et exécute func(début, fin) sur le pool
+     * Retourne quand tous les lots sont terminés (le thread appelant participe)
+     * Si func lève, les autres lots finissent puis la première exception est relancée
+     */
+    void parallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)> &func)
+    {
+        if (grainSize == 0)
+        {
+            grainSize = 1;
+        }
+
+        std::atomic<std::size_t> pending{(count + grainSize - 1) / grainSize};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        for (std::size_t begin = 0; begin < count; begin += grainSize)
+        {
+            std::size_t end = std::min(begin + grainSize, count);
+            submit([&func, &pending, &error, &errorMutex, begin, end]
+                   {
+                       try
+                       {
+                           func(begin, end);
+                       }
+                       catch (...)
+                       {
+                           std::lock_guard<std::mutex> lock(errorMutex);
+                           if (!error)
+                           {
+                               error = std::current_exception();
+                           }
+                       }
+                       pending.fetch_sub(1, std::memory_order_release);
+                   });
+        }
+        wait(pending);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::size_t getThreadCount() const { return workers.size(); }
+};
@@ -101,6 +101,7 @@ private:
             }
 
             std::string imagePath = baseDirectory + std::string(imageSource);
+            thisTileset.imagePath = imagePath;
             thisTileset.texture = loadTexture(imagePath.c_str(), renderer);
 
             if (!thisTileset.texture)
@@ -130,6 +131,7 @@ private:
             }
 
             std::string imagePath = baseDirectory + std::string(imageSource);
+            thisTileset.imagePath = imagePath;
             thisTileset.texture = loadTexture(imagePath.c_str(), renderer);
 
             if (!thisTileset.texture)